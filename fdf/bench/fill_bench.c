@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fill_bench.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/29 17:02:51 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/29 17:02:51 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+#include <stdio.h>
+
+#ifndef BENCH_SIDE
+# define BENCH_SIDE 512
+#endif
+
+#ifndef BENCH_FRAMES
+# define BENCH_FRAMES 30
+#endif
+
+#ifndef BENCH_ANGLE
+# define BENCH_ANGLE 0.010
+#endif
+
+#ifndef BENCH_W
+# define BENCH_W 1600
+#endif
+
+#ifndef BENCH_H
+# define BENCH_H 900
+#endif
+
+// This function fills a square grid with rolling hills
+static void	bench_grid(t_grid *grid)
+{
+	size_t	i;
+
+	if (!grid_alloc(grid, BENCH_SIDE, BENCH_SIDE))
+		malloc_error();
+	i = -1;
+	while (++i < grid->size)
+	{
+		grid->x[i] = i % BENCH_SIDE;
+		grid->y[i] = i / BENCH_SIDE;
+		grid->z[i] = 20 * sin(grid->x[i] / 16) * cos(grid->y[i] / 23);
+		grid->color[i] = DEFAULT_COLOR;
+	}
+}
+
+// This function sets the map up the way get_matrix and
+// window do, the frames being drawn into memory
+static unsigned int	*bench_setup(void)
+{
+	static t_win	window;
+	static t_coor	coor;
+	unsigned int	*pixels;
+
+	window.win_w = BENCH_W;
+	window.win_h = BENCH_H;
+	map()->win = &window;
+	map()->coor = &coor;
+	bench_grid(&map()->grid);
+	lod_build();
+	set_model_bounds();
+	get_scaling_factor();
+	view_init();
+	pixels = malloc(sizeof(unsigned int) * BENCH_W * BENCH_H);
+	if (!pixels)
+		malloc_error();
+	raster_init(&map()->raster, (char *)pixels,
+		BENCH_W * sizeof(unsigned int));
+	render_init();
+	return (pixels);
+}
+
+// This function counts the primitives binned for the
+// last frame, each face being 3 entries of a band
+static size_t	bench_primitives(void)
+{
+	size_t	count;
+	int		i;
+
+	count = 0;
+	i = -1;
+	while (++i < RENDER_THREADS)
+		count += map()->render.bands[i].count;
+	if (map()->fill)
+		count /= 3;
+	return (count);
+}
+
+// This function times the frames of one of the render
+// modes while the map spins and prints its fill rate, the
+// pixels it colors per second
+static void	bench_mode(unsigned int *pixels, bool fill, char *name)
+{
+	struct timespec	start;
+	double			ms;
+	size_t			lit;
+	int				frame;
+
+	map()->fill = fill;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	frame = -1;
+	while (++frame < BENCH_FRAMES)
+	{
+		view_rotate(0, 0, BENCH_ANGLE);
+		render_grid();
+	}
+	ms = elapsed_us(start) / 1000.0 / BENCH_FRAMES;
+	lit = 0;
+	frame = -1;
+	while (++frame < BENCH_W * BENCH_H)
+		lit += pixels[frame] != 0;
+	printf("%-9s: %8.3f ms/frame %8.1f Mpixel/s %9zu primitives\n",
+		name, ms, lit / ms / 1000.0, bench_primitives());
+}
+
+// Benchmark of the fill rate of the filled surface against
+// the wireframe, both drawn through the render threads
+int	main(void)
+{
+	unsigned int	*pixels;
+
+	pixels = bench_setup();
+	printf("%dx%d map, %dx%d image, %d threads, %d frames\n", BENCH_SIDE,
+		BENCH_SIDE, BENCH_W, BENCH_H, RENDER_THREADS, BENCH_FRAMES);
+	bench_mode(pixels, false, "wireframe");
+	bench_mode(pixels, true, "filled");
+	free_project();
+	free_grid();
+	free(pixels);
+	return (0);
+}
@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   transform_bench.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/25 16:20:05 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/25 16:20:05 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+#include <stdio.h>
+
+#ifndef BENCH_SIDE
+# define BENCH_SIDE 1024
+#endif
+
+#ifndef BENCH_FRAMES
+# define BENCH_FRAMES 30
+#endif
+
+#ifndef BENCH_ANGLE
+# define BENCH_ANGLE 0.010
+#endif
+
+// Read at run time so the compiler can't fold the
+// sin and cos of the old rotations into constants
+static volatile double	g_angle = BENCH_ANGLE;
+
+// The vertex of the linked list the projection used to
+// rotate in place, kept here as the reference
+typedef struct s_node
+{
+	double	x;
+	double	y;
+	double	z;
+}			t_node;
+
+// The per-node rotations of the old projection, verbatim
+static void	rotate_x(t_node *node, double angle_x)
+{
+	double	new_y;
+	double	new_z;
+
+	new_y = node->y * cos(angle_x) + node->z * -sin(angle_x);
+	new_z = node->y * sin(angle_x) + node->z * cos(angle_x);
+	node->y = new_y;
+	node->z = new_z;
+}
+
+static void	rotate_y(t_node *node, double angle_y)
+{
+	double	new_x;
+	double	new_z;
+
+	new_x = node->x * cos(angle_y) + node->z * sin(angle_y);
+	new_z = node->x * -sin(angle_y) + node->z * cos(angle_y);
+	node->x = new_x;
+	node->z = new_z;
+}
+
+static void	rotate_z(t_node *node, double angle_z)
+{
+	double	new_x;
+	double	new_y;
+
+	new_x = node->x * cos(angle_z) + node->y * -sin(angle_z);
+	new_y = node->x * sin(angle_z) + node->y * cos(angle_z);
+	node->x = new_x;
+	node->y = new_y;
+}
+
+// This function times the old rotation of every node,
+// which is what a frame used to cost before drawing
+static double	bench_legacy(t_grid *grid)
+{
+	struct timespec	start;
+	t_node			*nodes;
+	size_t			i;
+	int				frame;
+	double			angle;
+
+	nodes = malloc(sizeof(t_node) * grid->size);
+	i = -1;
+	while (nodes && ++i < grid->size)
+		nodes[i] = (t_node){grid->x[i], grid->y[i], grid->z[i]};
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	frame = -1;
+	while (nodes && ++frame < BENCH_FRAMES)
+	{
+		angle = g_angle;
+		i = -1;
+		while (++i < grid->size)
+		{
+			rotate_x(&nodes[i], angle);
+			rotate_y(&nodes[i], angle);
+			rotate_z(&nodes[i], angle);
+		}
+	}
+	angle = elapsed_us(start) / 1000.0 / BENCH_FRAMES;
+	free(nodes);
+	return (angle);
+}
+
+// This function times the projection kernel over the
+// whole grid, rotating the view a little every frame
+static double	bench_kernel(t_grid *grid)
+{
+	struct timespec	start;
+	t_view			view;
+	t_transform		tf;
+	int				frame;
+	long long		sum;
+
+	view = (t_view){{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}, 1.5, 800, 450,
+	{BENCH_SIDE / 2, BENCH_SIDE / 2, 0}, false, {0, 0, 0}, 0, false};
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	frame = -1;
+	while (++frame < BENCH_FRAMES)
+	{
+		mat3_rotation('x', BENCH_ANGLE * frame, view.rot);
+		view_transform(&view, &tf);
+		project_block(&tf, grid, 0, grid->size);
+	}
+	sum = elapsed_us(start);
+	return (sum / 1000.0 / BENCH_FRAMES);
+}
+
+// This function fills a square grid with a bumpy surface
+static int	bench_grid(t_grid *grid)
+{
+	size_t	i;
+
+	if (!grid_alloc(grid, BENCH_SIDE, BENCH_SIDE))
+		return (0);
+	i = -1;
+	while (++i < grid->size)
+	{
+		grid->x[i] = i % BENCH_SIDE;
+		grid->y[i] = i / BENCH_SIDE;
+		grid->z[i] = (i * 2654435761u >> 16) % 64;
+		grid->color[i] = DEFAULT_COLOR;
+	}
+	return (1);
+}
+
+// This function frees the arrays of the grid
+static void	bench_free(t_grid *grid)
+{
+	free(grid->x);
+	free(grid->y);
+	free(grid->z);
+	free(grid->color);
+	free(grid->sx);
+	free(grid->sy);
+	free(grid->depth);
+}
+
+// Microbenchmark of the vertex projection: the old per-node
+// rotate_x/y/z against the SIMD kernel, in ms per frame
+int	main(void)
+{
+	static t_grid	grid_data;
+	t_grid			*grid;
+	double			legacy;
+	double			kernel;
+
+	grid = &grid_data;
+	if (!bench_grid(grid))
+		return (bench_free(grid), 1);
+	printf("%d vertices, %d frames\n", (int)grid->size, BENCH_FRAMES);
+	legacy = bench_legacy(grid);
+	printf("rotate_x/y/z per node: %8.3f ms/frame %8.1f Mvert/s\n",
+		legacy, grid->size / legacy / 1000.0);
+	kernel = bench_kernel(grid);
+	printf("%-21s: %8.3f ms/frame %8.1f Mvert/s\n", "kernel "
+		TRANSFORM_KERNEL, kernel, grid->size / kernel / 1000.0);
+	printf("speedup: %.1fx\n", legacy / kernel);
+	bench_free(grid);
+	return (0);
+}
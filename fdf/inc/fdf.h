@@ -20,21 +20,32 @@
 # include <math.h>
 # include <fcntl.h>
 # include <errno.h>
+# include <pthread.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <time.h>
+# include <sys/resource.h>
+# include <string.h>
+# include <stdint.h>
+
+# ifndef ZOOM_SPEED
+#  define ZOOM_SPEED 2.0
+# endif
 
-# ifndef ZOOM_IN_RATIO
-#  define ZOOM_IN_RATIO 1.015
+# ifndef TRANSLATION_SPEED
+#  define TRANSLATION_SPEED 400
 # endif
 
-# ifndef ZOOM_OUT_RATIO
-#  define ZOOM_OUT_RATIO 0.965
+# ifndef ROTATION_SPEED
+#  define ROTATION_SPEED 1.2
 # endif
 
-# ifndef TRANSLATION_RATIO
-#  define TRANSLATION_RATIO 5
+# ifndef FRAME_RATE
+#  define FRAME_RATE 60
 # endif
 
-# ifndef ROTATION_RATIO
-#  define ROTATION_RATIO 0.010
+# ifndef MAX_FRAME_TIME
+#  define MAX_FRAME_TIME 0.1
 # endif
 
 # ifndef M_PI
@@ -97,6 +108,38 @@
 #  define KEY_RESET 48
 # endif
 
+# ifndef KEY_FILL
+#  define KEY_FILL 102
+# endif
+
+# ifndef KEY_SMOOTH
+#  define KEY_SMOOTH 108
+# endif
+
+# ifndef KEY_PERSPECTIVE
+#  define KEY_PERSPECTIVE 112
+# endif
+
+# ifndef KEY_HUD
+#  define KEY_HUD 104
+# endif
+
+# ifndef HUD_COLOR
+#  define HUD_COLOR 0xFFFFFF
+# endif
+
+# ifndef HUD_MARGIN
+#  define HUD_MARGIN 16
+# endif
+
+# ifndef HUD_LINE
+#  define HUD_LINE 16
+# endif
+
+# ifndef STATS_LINE
+#  define STATS_LINE 256
+# endif
+
 # ifndef ON_KEYDOWN
 #  define ON_KEYDOWN 2
 # endif
@@ -105,19 +148,408 @@
 #  define ON_DESTROY 17
 # endif
 
-typedef struct s_node
+# ifndef LOAD_THREADS
+#  define LOAD_THREADS 8
+# endif
+
+# ifndef ROWS_PER_THREAD
+#  define ROWS_PER_THREAD 64
+# endif
+
+# ifndef ROW_OK
+#  define ROW_OK 1
+# endif
+
+# ifndef ROW_BAD_WIDTH
+#  define ROW_BAD_WIDTH 0
+# endif
+
+# ifndef ROW_BAD_ELEMENT
+#  define ROW_BAD_ELEMENT -1
+# endif
+
+# ifndef TILE_NO_MEMORY
+#  define TILE_NO_MEMORY -2
+# endif
+
+# ifndef TILE_BAD_WRITE
+#  define TILE_BAD_WRITE -3
+# endif
+
+# ifndef DEFAULT_COLOR
+#  define DEFAULT_COLOR 0xFFFFFF
+# endif
+
+# ifndef SCREEN_CLAMP
+#  define SCREEN_CLAMP 1000000000.0f
+# endif
+
+# ifndef CLIP_LEFT
+#  define CLIP_LEFT 1
+# endif
+
+# ifndef CLIP_RIGHT
+#  define CLIP_RIGHT 2
+# endif
+
+# ifndef CLIP_TOP
+#  define CLIP_TOP 4
+# endif
+
+# ifndef CLIP_BOTTOM
+#  define CLIP_BOTTOM 8
+# endif
+
+# ifndef CLIP_NEAR
+#  define CLIP_NEAR 16
+# endif
+
+# ifndef RENDER_THREADS
+#  define RENDER_THREADS 8
+# endif
+
+# ifndef EDGE_OFFSET_SHIFT
+#  define EDGE_OFFSET_SHIFT 32
+# endif
+
+# ifndef EDGE_FIRST_MASK
+#  define EDGE_FIRST_MASK 0xFFFFFFFFUL
+# endif
+
+# ifndef EDGE_CUT
+#  define EDGE_CUT 0x8000000000000000UL
+# endif
+
+# ifndef CAMERA_FOV
+#  define CAMERA_FOV 1.0
+# endif
+
+# ifndef CAMERA_FOV_MIN
+#  define CAMERA_FOV_MIN 0.2
+# endif
+
+# ifndef CAMERA_FOV_MAX
+#  define CAMERA_FOV_MAX 2.6
+# endif
+
+# ifndef CAMERA_NEAR
+#  define CAMERA_NEAR 0.5f
+# endif
+
+# ifndef CAMERA_TILT
+#  define CAMERA_TILT 1.0
+# endif
+
+# ifndef FILL_AMBIENT
+#  define FILL_AMBIENT 0.3
+# endif
+
+# ifndef FILL_LOW
+#  define FILL_LOW 0.35
+# endif
+
+# ifndef HEADLESS_W
+#  define HEADLESS_W 1600
+# endif
+
+# ifndef HEADLESS_H
+#  define HEADLESS_H 900
+# endif
+
+# ifndef BINARY_VERSION
+#  define BINARY_VERSION 1
+# endif
+
+# ifndef BINARY_CHUNK
+#  define BINARY_CHUNK 4096
+# endif
+
+# ifndef STREAM_VERSION
+#  define STREAM_VERSION 1
+# endif
+
+# ifndef STREAM_TILE
+#  define STREAM_TILE 128
+# endif
+
+# ifndef STREAM_ALIGN
+#  define STREAM_ALIGN 65536
+# endif
+
+# ifndef STREAM_VIEW
+#  define STREAM_VIEW 1024
+# endif
+
+# ifndef STREAM_SLACK
+#  define STREAM_SLACK 64
+# endif
+
+# ifndef STREAM_PREFETCH
+#  define STREAM_PREFETCH 1
+# endif
+
+# ifndef STREAM_CACHE
+#  define STREAM_CACHE 160
+# endif
+
+# ifndef LOD_TILE
+#  define LOD_TILE 32
+# endif
+
+# ifndef LOD_PIXELS
+#  define LOD_PIXELS 2.0
+# endif
+
+# if defined(__AVX2__) && !defined(NO_SIMD)
+#  include <immintrin.h>
+#  define TRANSFORM_KERNEL "avx2"
+# elif defined(__SSE2__) && !defined(NO_SIMD)
+#  include <emmintrin.h>
+#  define TRANSFORM_KERNEL "sse2"
+# else
+#  define TRANSFORM_KERNEL "scalar"
+# endif
+
+// The map is stored row-major as a structure of arrays:
+// the east neighbour of the vertex i is i + 1 and the
+// south one is i + width, sx, sy and depth hold the
+// projection of the last frame
+typedef struct s_grid
+{
+	int				width;
+	int				height;
+	size_t			size;
+	float			*x;
+	float			*y;
+	float			*z;
+	unsigned int	*color;
+	int				*sx;
+	int				*sy;
+	float			*depth;
+}			t_grid;
+
+// The min/max height quadtree of the map, its leaves
+// being tiles of LOD_TILE cells and each level merging
+// 2x2 nodes of the one below, step holds for each tile
+// log2 of the step it is drawn at plus 1, 0 if culled
+typedef struct s_lod
+{
+	int				tiles_w;
+	int				tiles_h;
+	int				levels;
+	float			**zmin;
+	float			**zmax;
+	unsigned char	*step;
+}			t_lod;
+
+// The cells [x0, x1] x [y0, y1] of a tile of the
+// map and the step its vertices are picked at
+typedef struct s_tile
+{
+	int	x0;
+	int	x1;
+	int	y0;
+	int	y1;
+	int	step;
+}			t_tile;
+
+typedef struct s_row
+{
+	char	*begin;
+	char	*end;
+}			t_row;
+
+// The whole map file mapped in memory
+// and the non-empty lines found in it
+typedef struct s_map_file
+{
+	char	*data;
+	size_t	len;
+	t_row	*rows;
+	int		rows_amount;
+	int		rows_capacity;
+}			t_map_file;
+
+// The rows [first, last) a loader thread parses
+typedef struct s_loader
+{
+	t_row		*rows;
+	int			first;
+	int			last;
+	int			status;
+	bool		threaded;
+	t_grid		*grid;
+	pthread_t	thread;
+}			t_loader;
+
+// A rectangle of pixels, bounds included
+typedef struct s_clip
+{
+	int	min_x;
+	int	min_y;
+	int	max_x;
+	int	max_y;
+}			t_clip;
+
+// The pixels lines are drawn into, stride being the
+// distance between two rows and clip the rectangle
+// no line can leave, only the rows [row_min, row_max]
+// are written, depth is the depth buffer of the faces
+typedef struct s_raster
+{
+	unsigned int	*pixels;
+	float			*depth;
+	int				stride;
+	t_clip			clip;
+	int				row_min;
+	int				row_max;
+}			t_raster;
+
+// An edge of the map in screen space
+typedef struct s_segment
+{
+	int				x[2];
+	int				y[2];
+	unsigned int	color[2];
+}			t_segment;
+
+// The transform of a frame, screen = m * model + t, kept
+// in single precision for the projection kernel; its
+// last row is w, 1 for the orthographic view and the
+// distance in front of the camera in perspective, that
+// the screen coordinates are divided by
+typedef struct s_transform
+{
+	float	m[4][3];
+	float	t[4];
+	bool	perspective;
+}			t_transform;
+
+// A horizontal band of the image and the edges crossing
+// it, each edge being its first vertex with the offset
+// to the second one shifted by EDGE_OFFSET_SHIFT, or the
+// index of a cut segment with EDGE_CUT set, or in fill
+// mode the faces crossing it, 3 vertices each
+typedef struct s_band
+{
+	t_raster	raster;
+	size_t		*edges;
+	size_t		count;
+	size_t		capacity;
+	pthread_t	thread;
+}			t_band;
+
+// The render threads, the band i + 1 being drawn by the
+// worker i, generation tells them a new frame started;
+// cuts holds the edges of the frame the near plane cut,
+// already in screen space, and tf its transform
+typedef struct s_render
 {
-	int				id;
-	double			x;
-	double			y;
-	double			z;
-	double			origin_x;
-	double			origin_y;
-	double			origin_z;
-	long long		color;
-	struct s_node	*east;
-	struct s_node	*south;
-}			t_node;
+	t_band			bands[RENDER_THREADS];
+	t_segment		*cuts;
+	size_t			cut_count;
+	size_t			cut_capacity;
+	t_transform		*tf;
+	int				band_h;
+	int				workers;
+	int				pending;
+	int				generation;
+	bool			running;
+	pthread_mutex_t	lock;
+	pthread_cond_t	start;
+	pthread_cond_t	done;
+}			t_render;
+
+// The header of a binary map, followed by the heights of its
+// vertices row-major, as integers of depth bytes, then if it
+// is colored by their colors as 0xRRGGBB on 4 bytes, that
+// plane starting at the next multiple of 4
+typedef struct s_binary
+{
+	char	magic[4];
+	int		version;
+	int		width;
+	int		height;
+	int		zmin;
+	int		zmax;
+	int		depth;
+	int		colored;
+}			t_binary;
+
+// The header of a tiled map, padded to STREAM_ALIGN bytes
+// and followed by its tiles of tile x tile vertices, row
+// after row, each one holding the heights of its vertices
+// then their colors, the tiles of the last row and column
+// being padded
+typedef struct s_tiled
+{
+	char	magic[4];
+	int		version;
+	int		width;
+	int		height;
+	int		tile;
+	int		tiles_w;
+	int		tiles_h;
+	float	zmin;
+	float	zmax;
+}			t_tiled;
+
+// A tile of a tiled map mapped in memory
+// and the tick it was last needed at
+typedef struct s_cached
+{
+	int			tx;
+	int			ty;
+	float		*data;
+	long long	used;
+}			t_cached;
+
+// A tiled map read from the disk: the grid is only the
+// window of it starting at origin, cut from the tiles of
+// the cache, core being the tiles it covers and ring the
+// ones around it the prefetch thread maps ahead, each
+// request asking it for a new ring, lock guards the cache
+typedef struct s_stream
+{
+	bool			active;
+	int				fd;
+	t_tiled			head;
+	int				origin_x;
+	int				origin_y;
+	t_cached		cache[STREAM_CACHE];
+	long long		tick;
+	t_clip			core;
+	t_clip			ring;
+	int				request;
+	bool			running;
+	bool			threaded;
+	pthread_t		thread;
+	pthread_mutex_t	lock;
+	pthread_cond_t	wake;
+}			t_stream;
+
+// A triangle of the map in screen space, a holding the
+// depth and the shaded channels of its vertices and
+// dx and dy how they change from a pixel to the next
+typedef struct s_face
+{
+	double	x[3];
+	double	y[3];
+	float	a[4][3];
+	float	dx[4];
+	float	dy[4];
+}			t_face;
+
+// The state of the walk of a segment, the position
+// and the channels of the color being 16.16 fixed point
+typedef struct s_line
+{
+	long	pos[2];
+	long	inc[2];
+	long	len;
+	int		rgb[3];
+	int		drgb[3];
+}			t_line;
 
 typedef struct s_window_infos
 {
@@ -131,10 +563,6 @@ typedef struct s_window_infos
 
 typedef struct s_coor
 {
-	double					x;
-	double					y;
-	double					delta_x;
-	double					delta_y;
 	double					max_x;
 	double					max_y;
 	double					max_z;
@@ -145,11 +573,28 @@ typedef struct s_coor
 	double					range_y;
 	double					range_z;
 	double					max_range;
-	double					x_center;
-	double					y_center;
-	unsigned long long		size;
+	bool					z_known;
 }				t_coor;
 
+// The camera of the map: the model is never modified,
+// each frame is projected with rot, scale and the
+// offsets, rotations and zoom pivot around center; in
+// perspective the camera sits at eye, its axes being the
+// rows of rot, and sees fov radians across the window;
+// recenter asks the next frame to center the projection
+typedef struct s_view
+{
+	double	rot[3][3];
+	double	scale;
+	double	offset_x;
+	double	offset_y;
+	double	center[3];
+	bool	perspective;
+	double	eye[3];
+	double	fov;
+	bool	recenter;
+}			t_view;
+
 typedef struct s_keybinds
 {
 	bool	left;
@@ -167,6 +612,52 @@ typedef struct s_keybinds
 	bool	reset;
 }			t_keybinds;
 
+// The frame scheduler, last_update being when the view
+// was last moved and dirty telling a frame has to be drawn
+typedef struct s_frame
+{
+	long long	last_update;
+	bool		dirty;
+}			t_frame;
+
+// The stats of the last frame: the time spent projecting,
+// drawing and presenting it and since the frame before,
+// the vertices it projected, the edges or faces it drew
+// and those cut by the edges of the window or culled,
+// fps10 being the frames per second times 10 over about
+// a second, memory the bytes the map and its rendering
+// hold and log the CSV log, 0 if there is none
+typedef struct s_stats
+{
+	long long	transform_us;
+	long long	raster_us;
+	long long	present_us;
+	long long	interval_us;
+	long long	last_frame;
+	long long	second_start;
+	long long	second_frames;
+	long long	fps10;
+	size_t		vertices;
+	size_t		segments;
+	size_t		clipped;
+	size_t		memory;
+	int			frames;
+	int			log;
+	bool		hud;
+}			t_stats;
+
+// A run without a window, prefix naming the PPM files
+// its frames are written to, if any, and the time spent
+// loading the map and projecting and drawing the frames
+typedef struct s_headless
+{
+	char		*prefix;
+	int			frames;
+	long long	load_us;
+	long long	transform_us;
+	long long	raster_us;
+}				t_headless;
+
 typedef struct s_matrix_infos
 {
 	int			columns_amount;
@@ -174,89 +665,171 @@ typedef struct s_matrix_infos
 	double		sf;
 	int			bpp;
 	int			endian;
-	t_node		*head;
+	t_grid		grid;
+	t_lod		lod;
+	t_view		view;
+	t_raster	raster;
+	t_render	render;
+	t_frame		frame;
+	t_stream	stream;
+	t_stats		stats;
+	bool		fill;
+	bool		smooth;
 	t_coor		*coor;
 	t_keybinds	keys;
 }				t_matrix;
 
 // errors
 void		malloc_error(void);
+void		map_error(char *message);
 int			handle_open(char *file_name);
 void		handle_close(int fd);
 // errors
 
+// grid
+int			grid_alloc(t_grid *grid, int width, int height);
+void		grid_free(t_grid *grid);
+int			lod_alloc(t_lod *lod, t_grid *grid);
+int			lod_level_size(int tiles, int level);
+void		lod_tile(t_tile *t, int tx, int ty);
+void		lod_build(void);
+void		lod_free(t_lod *lod);
+void		node_box(int level, int tx, int ty, double box[6]);
+bool		box_visible(t_transform *tf, double box[6], double *size);
+void		lod_bounds(t_transform *tf, double bb[4]);
+void		lod_select(t_transform *tf);
+int			lod_step(int tx, int ty);
+// grid
+
+// headless
+int			headless(int ac, char **av);
+void		headless_frame(t_headless *h);
+int			run_script(char *script, t_headless *h);
+void		write_ppm(char *prefix, int frame);
+// headless
+
 // handle_map
-void		apply_mod(int set_origin, char direction);
 t_matrix	*map(void);
-int			convert_line_into_coordinates(char **array, int y);
+void		set_ranges(void);
 void		get_scaling_factor(void);
-void		expand_map(void);
+void		set_model_bounds(void);
+void		view_init(void);
 void		get_matrix(char *file_name);
+void		load_map(char *file_name);
+void		map_file(char *file_name, t_map_file *file, int advice);
+void		open_map(char *file_name, t_map_file *file, int advice);
+void		load_binary(char *file_name);
+int			convert_map(char *file_name, char *binary_name);
+size_t		binary_colors(t_binary *head);
+void		unmap_file(t_map_file *file);
+int			parse_rows(t_grid *grid, t_row *rows, int rows_amount);
+int			count_elements(t_row row);
+int			is_blank(char c);
+int			hex_value(char c);
+void		report_load(char *file_name, size_t bytes, long long us);
 // handle_map
 
 // lines
-void		generate_lines(int fd);
-void		generate_line_phase_1(char **line, char ***array);
-void		generate_line_phase_2(int fd, char **line, char ***array, int *y);
-void		draw_line(t_node *first, t_node *second);
-void		draw_horizontal_lines(void);
-void		draw_vertical_lines(void);
+int			line_color(int first_color, int second_color, float delta);
+int			clip_segment(t_clip *clip, t_segment *s);
+void		line_init(t_line *line, t_segment *s);
+void		line_step(t_line *l, long k);
+void		line_skip(t_line *l, int row);
+void		segment_flip(t_segment *s);
+void		draw_segment(t_raster *raster, t_segment *s);
+void		draw_smooth(t_raster *raster, t_segment *s);
+void		raster_init(t_raster *raster, char *addr, int line_len);
+void		bin_edge(t_render *render, size_t first, size_t second);
+void		bin_span(t_render *render, int top, int bottom, size_t edge);
+size_t		cut_push(t_render *render, t_segment *s);
+bool		edge_kept(t_grid *grid, size_t first, size_t second);
+void		bin_cut(t_render *render, size_t first, size_t second);
+void		bin_face(t_render *render, size_t a, size_t b, size_t c);
+bool		face_init(t_face *f, t_grid *grid, size_t *v);
+void		face_draw(t_raster *raster, size_t *v);
+void		emit_faces(t_transform *tf, t_tile *t, int tx, int ty);
+void		emit_edges(t_tile *t, int tx, int ty);
+void		band_draw(t_band *band);
+void		render_init(void);
+void		render_bands(void);
+void		render_destroy(void);
+void		draw_edge(t_raster *raster, size_t edge);
+void		lod_bin(t_transform *tf);
+void		render_grid(void);
 // lines
 
 // projection
-void		center_map_width(double max_x, double min_x);
-void		center_map_height(double max_y, double min_y);
-void		center_map(void);
 void		handle_arrow_keys(int key_code, bool pressed);
 void		handle_wasdeq_keys(int key_code, bool pressed);
 int			handle_keybinds(int key_code, bool pressed);
 int			on_key_pressed(int key_code);
 int			on_key_released(int key_code);
 int			central_control(void);
-void		translation_controls(bool *changed);
-void		rotation_controls(bool *changed);
-void		rebuild_projection(void);
+bool		motion_controls(double dt);
 void		reset_projection(bool *changed);
+void		toggle_fill(void);
+void		toggle_smooth(void);
+int			present_image(void);
 void		rebuild_image(void);
-void		rotate_x(t_node *node, double angle_x);
-void		rotate_y(t_node *node, double angle_y);
-void		rotate_z(t_node *node, double angle_z);
-void		apply_rotation(double angle_x, double angle_y, double angle_z);
-void		set_z_max_min(void);
-void		set_new_max_xy(void);
-void		set_new_min_xy(void);
-void		set_ranges(void);
-double		rad_clamp(double val);
-void		rescale_projection(double sf);
-void		calculate_center(double *x_center, double *y_center);
+void		mat3_mul(double a[3][3], double b[3][3], double out[3][3]);
+void		mat3_identity(double m[3][3]);
+void		mat3_rotation(char axis, double angle, double m[3][3]);
+void		mat3_orthonormalize(double m[3][3]);
+void		view_center(void);
+void		view_reset(void);
+void		view_rotate(double angle_x, double angle_y, double angle_z);
+void		view_zoom(double sf);
+void		view_translate(double x, double y);
+void		view_transform(t_view *view, t_transform *tf);
+void		camera_transform(t_view *view, t_transform *tf);
+void		camera_reset(t_view *view);
+void		camera_move(double x, double y);
+void		camera_zoom(double sf);
+void		toggle_perspective(void);
+size_t		project_simd(t_transform *tf, t_grid *g, size_t i, size_t last);
+void		project_block(t_transform *tf, t_grid *grid,
+				size_t first, size_t count);
+void		view_bounds(t_transform *tf, double box[6], double bb[4]);
 // projection
 
-// queue
-int			color_checker(char *color);
-int			color_build(char *color);
-t_node		*create_node(int altitude, int x, int y, int color);
-int			build_node(char *str, int x, int y);
-t_node		*dig_and_search(int y);
-t_node		*search_on_the_right(t_node *node_above, int x);
-t_node		*shift_layers(int x);
-void		connect_above_node(t_node *node);
-void		queue_add_node(t_node *node);
-// queue
+// stats
+void		append_number(char *text, long long value, int decimals);
+void		stats_frame(void);
+int			stats_open(char *log_name);
+void		stats_log(void);
+void		stats_close(void);
+void		hud_draw(void);
+void		toggle_hud(void);
+// stats
+
+// stream
+int			tile_map(char *file_name, char *tiled_name);
+int			convert_bands(t_map_file *file, t_tiled *head, int fd);
+size_t		tile_bytes(t_tiled *head);
+float		*cache_tile(t_stream *stream, int tx, int ty);
+void		cache_clear(t_stream *stream);
+void		prefetch_start(t_stream *stream);
+void		prefetch_stop(t_stream *stream);
+void		stream_open(char *file_name);
+void		stream_fill(void);
+void		stream_follow(t_transform *tf);
+void		stream_close(void);
+// stream
 
 // utils
+int			has_extension(char *file_name, char *extension);
 int			file_name_checker(char *file_name);
 void		free_split(char **array);
-void		check_south(t_node	**head, t_node **previous);
-void		check_east(t_node **head, t_node **previous);
-void		free_nodes(void);
+void		free_grid(void);
 void		free_project(void);
+long long	elapsed_us(struct timespec start);
+long long	now_us(void);
+void		put_ms(long long us);
 // utils
 
 // window
 void		window_init(void);
 void		window(void);
-void		put_pixel(int x, int y, int color);
-void		put_pixels_on_img(void);
 int			mouse_destroy_window(void);
 // window
 
@@ -17,7 +17,19 @@
 void	malloc_error(void)
 {
 	ft_putendl_fd("Error: Memory allocation failed! Exiting...", 2);
-	free_nodes();
+	free_grid();
+	free_project();
+	exit(EXIT_FAILURE);
+}
+
+// This function stops the program when
+// the map file can't be turned into a grid
+void	map_error(char *message)
+{
+	ft_putstr_fd("Error: ", 2);
+	ft_putstr_fd(message, 2);
+	ft_putendl_fd(" Exiting...", 2);
+	free_grid();
 	free_project();
 	exit(EXIT_FAILURE);
 }
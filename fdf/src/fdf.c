@@ -12,24 +12,52 @@
 
 #include "fdf.h"
 
-int	main(int ac, char **av)
+// This function prints the ways fdf can be run
+static void	usage(void)
+{
+	ft_putendl_fd("Error: Usage -> ./fdf \"file_name\"", 2);
+	ft_putendl_fd("   or ./fdf --headless \"file_name\" [script [prefix]]", 2);
+	ft_putendl_fd("   or ./fdf --convert \"file_name\" \"binary_name\"", 2);
+	ft_putendl_fd("   or ./fdf --tile \"file_name\" \"tiled_name\"", 2);
+	ft_putendl_fd("   each after --log \"log_name\" to log frame stats", 2);
+}
+
+// This function opens the map in a window
+static void	run_window(char *file_name)
 {
 	static t_coor	coor;
 
-	if (ac == 2)
+	if (!file_name_checker(file_name))
+	{
+		ft_putendl_fd("Error: File extension is invalid!", 2);
+		exit(EXIT_FAILURE);
+	}
+	map()->coor = &coor;
+	window_init();
+	get_matrix(file_name);
+	window();
+	free_grid();
+	free_project();
+}
+
+int	main(int ac, char **av)
+{
+	if (ac >= 4 && !ft_strncmp(av[1], "--log", 6))
 	{
-		if (!file_name_checker(av[1]))
-		{
-			ft_putendl_fd("Error: File extension is invalid!", 2);
-			exit(EXIT_FAILURE);
-		}
-		map()->coor = &coor;
-		get_matrix(av[1]);
-		window();
-		free_nodes();
-		free_project();
+		if (!stats_open(av[2]))
+			return (1);
+		ac -= 2;
+		av += 2;
 	}
+	if (ac >= 3 && !ft_strncmp(av[1], "--headless", 11))
+		return (headless(ac - 2, av + 2));
+	if (ac == 4 && !ft_strncmp(av[1], "--tile", 7))
+		return (tile_map(av[2], av[3]));
+	if (ac == 4 && !ft_strncmp(av[1], "--convert", 10))
+		return (convert_map(av[2], av[3]));
+	if (ac == 2)
+		run_window(av[1]);
 	else
-		ft_putendl_fd("Error: Usage -> ./fdf \"file_name\"", 2);
+		usage();
 	return (0);
 }
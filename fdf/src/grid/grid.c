@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grid.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/19 10:31:07 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/19 10:31:07 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function allocates the arrays of the
+// grid and of its projection at once
+int	grid_alloc(t_grid *grid, int width, int height)
+{
+	grid->width = width;
+	grid->height = height;
+	grid->size = (size_t)width * height;
+	grid->x = (float *)malloc(sizeof(float) * grid->size);
+	grid->y = (float *)malloc(sizeof(float) * grid->size);
+	grid->z = (float *)malloc(sizeof(float) * grid->size);
+	grid->color = (unsigned int *)malloc(sizeof(unsigned int) * grid->size);
+	grid->sx = (int *)malloc(sizeof(int) * grid->size);
+	grid->sy = (int *)malloc(sizeof(int) * grid->size);
+	grid->depth = (float *)malloc(sizeof(float) * grid->size);
+	if (!grid->x || !grid->y || !grid->z || !grid->color
+		|| !grid->sx || !grid->sy || !grid->depth)
+		return (0);
+	return (1);
+}
+
+// This function frees the arrays of the grid
+// and of its projection
+void	grid_free(t_grid *grid)
+{
+	free(grid->x);
+	free(grid->y);
+	free(grid->z);
+	free(grid->color);
+	free(grid->sx);
+	free(grid->sy);
+	free(grid->depth);
+	ft_bzero(grid, sizeof(t_grid));
+}
+
+// This function returns how many nodes a level of the
+// quadtree has along a side of tiles tiles
+int	lod_level_size(int tiles, int level)
+{
+	return ((tiles + (1 << level) - 1) >> level);
+}
+
+// This function allocates the levels of the quadtree,
+// from the tiles up to the root, a single node
+int	lod_alloc(t_lod *lod, t_grid *grid)
+{
+	size_t	size;
+	int		i;
+
+	lod->tiles_w = fmax(1, (grid->width - 2) / LOD_TILE + 1);
+	lod->tiles_h = fmax(1, (grid->height - 2) / LOD_TILE + 1);
+	lod->levels = 1;
+	while (lod_level_size(lod->tiles_w, lod->levels - 1) > 1
+		|| lod_level_size(lod->tiles_h, lod->levels - 1) > 1)
+		lod->levels++;
+	lod->zmin = (float **)ft_calloc(lod->levels, sizeof(float *));
+	lod->zmax = (float **)ft_calloc(lod->levels, sizeof(float *));
+	lod->step = (unsigned char *)ft_calloc(lod->tiles_w, lod->tiles_h);
+	if (!lod->zmin || !lod->zmax || !lod->step)
+		return (0);
+	i = -1;
+	while (++i < lod->levels)
+	{
+		size = (size_t)lod_level_size(lod->tiles_w, i)
+			* lod_level_size(lod->tiles_h, i);
+		lod->zmin[i] = (float *)malloc(sizeof(float) * size);
+		lod->zmax[i] = (float *)malloc(sizeof(float) * size);
+		if (!lod->zmin[i] || !lod->zmax[i])
+			return (0);
+	}
+	return (1);
+}
+
+// This function frees the levels of the quadtree
+void	lod_free(t_lod *lod)
+{
+	int	i;
+
+	i = 0;
+	while (lod->zmin && lod->zmax && i < lod->levels)
+	{
+		free(lod->zmin[i]);
+		free(lod->zmax[i++]);
+	}
+	free(lod->zmin);
+	free(lod->zmax);
+	free(lod->step);
+	ft_bzero(lod, sizeof(t_lod));
+}
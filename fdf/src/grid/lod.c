@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lod.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/28 11:02:17 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/28 11:02:17 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function sets the cells a tile covers
+// and the step it is drawn at this frame
+void	lod_tile(t_tile *t, int tx, int ty)
+{
+	t->x0 = tx * LOD_TILE;
+	t->x1 = fmin(t->x0 + LOD_TILE, map()->grid.width - 1);
+	t->y0 = ty * LOD_TILE;
+	t->y1 = fmin(t->y0 + LOD_TILE, map()->grid.height - 1);
+	t->step = lod_step(tx, ty);
+}
+
+// This function finds the lowest and highest
+// vertex of a tile, its borders included
+static void	tile_bounds(t_lod *lod, t_grid *grid, int tx, int ty)
+{
+	t_tile	t;
+	size_t	i;
+	int		x;
+
+	lod_tile(&t, tx, ty);
+	i = (size_t)ty * lod->tiles_w + tx;
+	lod->zmin[0][i] = grid->z[(size_t)t.y0 * grid->width + t.x0];
+	lod->zmax[0][i] = lod->zmin[0][i];
+	while (t.y0 <= t.y1)
+	{
+		x = t.x0 - 1;
+		while (++x <= t.x1)
+		{
+			lod->zmin[0][i] = fmin(lod->zmin[0][i],
+					grid->z[(size_t)t.y0 * grid->width + x]);
+			lod->zmax[0][i] = fmax(lod->zmax[0][i],
+					grid->z[(size_t)t.y0 * grid->width + x]);
+		}
+		t.y0++;
+	}
+}
+
+// This function sets a node to the lowest
+// and highest of its up to 2x2 children
+static void	merge_node(t_lod *lod, int level, int x, int y)
+{
+	size_t	node;
+	size_t	child;
+	int		cw;
+	int		dx;
+	int		dy;
+
+	cw = lod_level_size(lod->tiles_w, level - 1);
+	node = (size_t)y * lod_level_size(lod->tiles_w, level) + x;
+	child = (size_t)2 * y * cw + 2 * x;
+	lod->zmin[level][node] = lod->zmin[level - 1][child];
+	lod->zmax[level][node] = lod->zmax[level - 1][child];
+	dy = -1;
+	while (++dy < 2 && 2 * y + dy < lod_level_size(lod->tiles_h, level - 1))
+	{
+		dx = -1;
+		while (++dx < 2 && 2 * x + dx < cw)
+		{
+			child = (size_t)(2 * y + dy) *cw + 2 * x + dx;
+			lod->zmin[level][node] = fmin(lod->zmin[level][node],
+					lod->zmin[level - 1][child]);
+			lod->zmax[level][node] = fmax(lod->zmax[level][node],
+					lod->zmax[level - 1][child]);
+		}
+	}
+}
+
+// This function merges the nodes of the level below
+// into the nodes of a level of the quadtree
+static void	merge_level(t_lod *lod, int level)
+{
+	int	x;
+	int	y;
+
+	y = -1;
+	while (++y < lod_level_size(lod->tiles_h, level))
+	{
+		x = -1;
+		while (++x < lod_level_size(lod->tiles_w, level))
+			merge_node(lod, level, x, y);
+	}
+}
+
+// This function builds the min/max height quadtree
+// of the map the level of detail is picked with, it is
+// rebuilt in place whenever a streamed window moves
+void	lod_build(void)
+{
+	t_lod	*lod;
+	int		tx;
+	int		ty;
+	int		level;
+
+	lod = &map()->lod;
+	if (!lod->zmin && !lod_alloc(lod, &map()->grid))
+		malloc_error();
+	ty = -1;
+	while (++ty < lod->tiles_h)
+	{
+		tx = -1;
+		while (++tx < lod->tiles_w)
+			tile_bounds(lod, &map()->grid, tx, ty);
+	}
+	level = 0;
+	while (++level < lod->levels)
+		merge_level(lod, level);
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lod_bounds.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/11/06 16:41:09 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/11/06 16:41:09 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function grows the screen bounding box bb with the
+// vertices of a tile, through the rows of the transform
+// only, none of the buffers of the grid being written
+static void	tile_extent(t_transform *tf, int tx, int ty, double bb[4])
+{
+	t_grid	*grid;
+	size_t	i;
+	double	p[2];
+	int		x1;
+	int		y;
+
+	grid = &map()->grid;
+	x1 = fmin((tx + 1) * LOD_TILE, grid->width - 1);
+	y = ty * LOD_TILE - 1;
+	while (++y <= fmin((ty + 1) * LOD_TILE, grid->height - 1))
+	{
+		i = (size_t)y * grid->width + tx * LOD_TILE - 1;
+		while (++i <= (size_t)y * grid->width + x1)
+		{
+			p[0] = tf->m[0][0] * grid->x[i] + tf->m[0][1] * grid->y[i]
+				+ tf->m[0][2] * grid->z[i] + tf->t[0];
+			p[1] = tf->m[1][0] * grid->x[i] + tf->m[1][1] * grid->y[i]
+				+ tf->m[1][2] * grid->z[i] + tf->t[1];
+			bb[0] = fmin(bb[0], p[0]);
+			bb[1] = fmin(bb[1], p[1]);
+			bb[2] = fmax(bb[2], p[0]);
+			bb[3] = fmax(bb[3], p[1]);
+		}
+	}
+}
+
+// This function returns how far the box of a node of the
+// quadtree reaches out of the screen bounding box bb, 0
+// when it is inside it or out of the map
+static double	node_reach(t_transform *tf, int level, int node[2],
+		double bb[4])
+{
+	double	box[6];
+	double	grown[4];
+
+	if ((node[0] << level) >= map()->lod.tiles_w
+		|| (node[1] << level) >= map()->lod.tiles_h)
+		return (0);
+	node_box(level, node[0], node[1], box);
+	ft_memcpy(grown, bb, sizeof(grown));
+	view_bounds(tf, box, grown);
+	return (bb[0] - grown[0] + bb[1] - grown[1]
+		+ grown[2] - bb[2] + grown[3] - bb[3]);
+}
+
+// This function returns which of the 4 children of a
+// node reaches furthest out of the bounding box
+static int	reach_best(double reach[4])
+{
+	int	best;
+	int	c;
+
+	best = 0;
+	c = 0;
+	while (++c < 4)
+		if (reach[c] > reach[best])
+			best = c;
+	return (best);
+}
+
+// This function grows bb with the vertices under a node,
+// opening first the children reaching furthest out of it
+// and skipping the ones that no longer reach out once
+// their turn comes, so only a few tiles along the outline
+// of the projection are ever scanned
+static void	node_extent(t_transform *tf, int level, int node[2],
+		double bb[4])
+{
+	double	reach[4];
+	int		child[4][2];
+	int		best;
+	int		c;
+
+	if (!level)
+	{
+		tile_extent(tf, node[0], node[1], bb);
+		return ;
+	}
+	c = -1;
+	while (++c < 4)
+	{
+		child[c][0] = 2 * node[0] + (c & 1);
+		child[c][1] = 2 * node[1] + (c >> 1);
+		reach[c] = node_reach(tf, level - 1, child[c], bb);
+	}
+	best = reach_best(reach);
+	while (reach[best] > 0)
+	{
+		reach[best] = 0;
+		if (node_reach(tf, level - 1, child[best], bb) > 0)
+			node_extent(tf, level - 1, child[best], bb);
+		best = reach_best(reach);
+	}
+}
+
+// This function sets bb, as min x, min y, max x and max y,
+// to the screen bounding box of the map in the orthographic
+// view, the same as if every vertex had been projected
+void	lod_bounds(t_transform *tf, double bb[4])
+{
+	int	root[2];
+
+	bb[0] = HUGE_VAL;
+	bb[1] = HUGE_VAL;
+	bb[2] = -HUGE_VAL;
+	bb[3] = -HUGE_VAL;
+	root[0] = 0;
+	root[1] = 0;
+	node_extent(tf, map()->lod.levels - 1, root, bb);
+}
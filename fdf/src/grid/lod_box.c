@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lod_box.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/11/06 14:03:27 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/11/06 14:03:27 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function sets box to the cells and heights
+// a node of the quadtree covers, as x0 x1 y0 y1 z0 z1,
+// shifted by the origin of the window of a streamed map
+void	node_box(int level, int tx, int ty, double box[6])
+{
+	t_grid	*grid;
+	t_lod	*lod;
+	size_t	i;
+	int		ox;
+	int		oy;
+
+	grid = &map()->grid;
+	lod = &map()->lod;
+	ox = map()->stream.origin_x;
+	oy = map()->stream.origin_y;
+	i = (size_t)ty * lod_level_size(lod->tiles_w, level) + tx;
+	box[0] = ox + (double)(tx << level) *LOD_TILE;
+	box[1] = ox + fmin((double)((tx + 1) << level) *LOD_TILE, grid->width - 1);
+	box[2] = oy + (double)(ty << level) *LOD_TILE;
+	box[3] = oy + fmin((double)((ty + 1) << level) *LOD_TILE, grid->height - 1);
+	box[4] = lod->zmin[level][i];
+	box[5] = lod->zmax[level][i];
+}
+
+// This function projects the corner c of a box, growing
+// the screen bounding box bb with it, and returns the
+// planes of the view it is out of: the edges of the window
+// are tested before the division by w so a corner behind
+// the near plane is placed too
+static int	box_corner(t_transform *tf, double box[6], int c, double bb[4])
+{
+	double	p[3];
+	int		i;
+	int		r;
+	int		code;
+
+	i = -1;
+	while (++i < 3)
+	{
+		r = i + (i == 2);
+		p[i] = tf->m[r][0] * box[c & 1] + tf->m[r][1]
+			* box[2 + (c >> 1 & 1)] + tf->m[r][2] * box[4 + (c >> 2)]
+			+ tf->t[r];
+	}
+	code = (p[0] < 0) * CLIP_LEFT | (p[1] < 0) * CLIP_TOP
+		| (p[0] >= map()->win->win_w * p[2]) * CLIP_RIGHT
+		| (p[1] >= map()->win->win_h * p[2]) * CLIP_BOTTOM
+		| (p[2] < CAMERA_NEAR) * CLIP_NEAR;
+	if (code & CLIP_NEAR)
+		return (code);
+	bb[0] = fmin(bb[0], p[0] / p[2]);
+	bb[1] = fmin(bb[1], p[1] / p[2]);
+	bb[2] = fmax(bb[2], p[0] / p[2]);
+	bb[3] = fmax(bb[3], p[1] / p[2]);
+	return (code);
+}
+
+// This function projects the corners of a box and tells
+// whether it reaches the screen, that is whether no plane
+// of the view has all of them out, size being set to the
+// largest side of its screen bounding box; a box the near
+// plane cuts is kept at the finest step
+bool	box_visible(t_transform *tf, double box[6], double *size)
+{
+	double	bb[4];
+	int		all;
+	int		any;
+	int		code;
+	int		c;
+
+	bb[0] = HUGE_VAL;
+	bb[1] = HUGE_VAL;
+	bb[2] = -HUGE_VAL;
+	bb[3] = -HUGE_VAL;
+	all = ~0;
+	any = 0;
+	c = -1;
+	while (++c < 8)
+	{
+		code = box_corner(tf, box, c, bb);
+		all &= code;
+		any |= code;
+	}
+	*size = HUGE_VAL;
+	if (!(any & CLIP_NEAR))
+		*size = fmax(bb[2] - bb[0], bb[3] - bb[1]);
+	return (!all);
+}
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lod_select.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/28 11:40:52 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/28 11:40:52 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function walks the quadtree from a node, skipping
+// the ones off the screen, and gives each visible tile
+// the coarsest step keeping its cells under LOD_PIXELS
+static void	lod_visit(t_transform *tf, int level, int tx, int ty)
+{
+	t_lod	*lod;
+	double	box[6];
+	double	cell;
+	int		k;
+
+	lod = &map()->lod;
+	if ((tx << level) >= lod->tiles_w || (ty << level) >= lod->tiles_h)
+		return ;
+	node_box(level, tx, ty, box);
+	if (!box_visible(tf, box, &cell))
+		return ;
+	if (level)
+	{
+		k = -1;
+		while (++k < 4)
+			lod_visit(tf, level - 1, 2 * tx + (k & 1), 2 * ty + (k >> 1));
+		return ;
+	}
+	cell /= fmax(1, fmax(box[1] - box[0], box[3] - box[2]));
+	k = 1;
+	while ((1 << k) <= LOD_TILE && (1 << k) * cell <= LOD_PIXELS)
+		k++;
+	lod->step[(size_t)ty * lod->tiles_w + tx] = k;
+}
+
+// This function picks the step every tile of the map
+// is drawn at for this frame, 0 culling it
+void	lod_select(t_transform *tf)
+{
+	t_lod	*lod;
+
+	lod = &map()->lod;
+	ft_bzero(lod->step, (size_t)lod->tiles_w * lod->tiles_h);
+	lod_visit(tf, lod->levels - 1, 0, 0);
+}
+
+// This function returns the step in cells a tile is
+// drawn at, 0 if it is culled or not in the map
+int	lod_step(int tx, int ty)
+{
+	t_lod	*lod;
+
+	lod = &map()->lod;
+	if (tx < 0 || ty < 0 || tx >= lod->tiles_w || ty >= lod->tiles_h)
+		return (0);
+	if (!lod->step[(size_t)ty * lod->tiles_w + tx])
+		return (0);
+	return (1 << (lod->step[(size_t)ty * lod->tiles_w + tx] - 1));
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   binary_convert.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/11/02 10:27:53 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/11/02 10:27:53 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function turns a height of the grid back into
+// the integer it was read from, clamped to 32 bits
+static int	height_value(float z)
+{
+	return ((int)fmax(fmin(z, INT32_MAX), INT32_MIN));
+}
+
+// This function fills the header of the binary version of
+// the map: its heights take 2 bytes when they fit and the
+// colors are only kept if one isn't the default one
+static void	binary_header(t_binary *head, t_grid *grid)
+{
+	size_t	i;
+	int		z;
+
+	ft_bzero(head, sizeof(t_binary));
+	ft_memcpy(head->magic, "FDFB", 4);
+	head->version = BINARY_VERSION;
+	head->width = grid->width;
+	head->height = grid->height;
+	head->zmin = INT32_MAX;
+	head->zmax = INT32_MIN;
+	i = 0;
+	while (i < grid->size)
+	{
+		z = height_value(grid->z[i]);
+		head->zmin = fmin(head->zmin, z);
+		head->zmax = fmax(head->zmax, z);
+		if (grid->color[i++] != DEFAULT_COLOR)
+			head->colored = 1;
+	}
+	head->depth = 4;
+	if (head->zmin >= INT16_MIN && head->zmax <= INT16_MAX)
+		head->depth = 2;
+}
+
+// This function writes len bytes, retrying
+// as long as the writes are partial
+static int	write_all(int fd, void *data, size_t len)
+{
+	ssize_t	written;
+
+	while (len > 0)
+	{
+		written = write(fd, data, len);
+		if (written <= 0)
+			return (0);
+		data = (char *)data + written;
+		len -= written;
+	}
+	return (1);
+}
+
+// This function writes the heights of the grid as integers
+// of depth bytes, BINARY_CHUNK of them at a time
+static int	write_heights(int fd, t_grid *grid, int depth)
+{
+	int16_t	half[BINARY_CHUNK];
+	int32_t	full[BINARY_CHUNK];
+	size_t	i;
+	size_t	n;
+
+	i = 0;
+	while (i < grid->size)
+	{
+		n = 0;
+		while (n < BINARY_CHUNK && i + n < grid->size)
+		{
+			full[n] = height_value(grid->z[i + n]);
+			half[n] = full[n];
+			n++;
+		}
+		if (depth == 2 && !write_all(fd, half, n * sizeof(int16_t)))
+			return (0);
+		if (depth == 4 && !write_all(fd, full, n * sizeof(int32_t)))
+			return (0);
+		i += n;
+	}
+	return (1);
+}
+
+// Main function to convert a map to the binary format:
+// ./fdf --convert map.fdf map.fdfb, the colors being
+// written at their offset, after the padding of the heights
+int	convert_map(char *file_name, char *binary_name)
+{
+	t_binary	head;
+	t_grid		*grid;
+	int			fd;
+	int			ok;
+
+	if (!has_extension(file_name, ".fdf")
+		|| !has_extension(binary_name, ".fdfb"))
+		return (ft_putendl_fd("Error: File extension is invalid!", 2), 1);
+	load_map(file_name);
+	grid = &map()->grid;
+	binary_header(&head, grid);
+	fd = open(binary_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	ok = fd != -1 && write_all(fd, &head, sizeof(t_binary))
+		&& write_heights(fd, grid, head.depth);
+	if (ok && head.colored)
+		ok = lseek(fd, binary_colors(&head), SEEK_SET) != -1
+			&& write_all(fd, grid->color, sizeof(unsigned int) * grid->size);
+	if (fd == -1 || close(fd) == -1 || !ok)
+	{
+		unlink(binary_name);
+		map_error("Binary map can't be written!");
+	}
+	ft_printf("Converted %s: %d-bit heights\n", binary_name, head.depth * 8);
+	free_grid();
+	return (0);
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   binary_load.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/11/02 09:41:26 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/11/02 09:41:26 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function returns where the colors of a binary
+// map start, right after its heights, on 4 bytes
+size_t	binary_colors(t_binary *head)
+{
+	size_t	end;
+
+	end = sizeof(t_binary) + (size_t)head->width * head->height * head->depth;
+	return ((end + 3) & ~(size_t)3);
+}
+
+// This function checks the header of a binary map
+// and that the file is long enough for its planes
+static int	binary_check(t_binary *head, size_t len)
+{
+	size_t	size;
+
+	if (ft_strncmp(head->magic, "FDFB", 4) || head->version != BINARY_VERSION
+		|| head->width < 1 || head->height < 1 || head->zmin > head->zmax
+		|| (head->depth != 2 && head->depth != 4))
+		return (0);
+	size = (size_t)head->width * head->height;
+	if (size > (len - sizeof(t_binary)) / head->depth)
+		return (0);
+	if (!head->colored)
+		return (1);
+	return (len >= binary_colors(head)
+		&& (len - binary_colors(head)) / sizeof(unsigned int) >= size);
+}
+
+// This function widens the heights of the plane to the
+// floats of the grid, a plain loop the compiler vectorizes
+static void	unpack_heights(t_grid *grid, char *plane, int depth)
+{
+	int16_t	*half;
+	int32_t	*full;
+	size_t	i;
+
+	half = (int16_t *)plane;
+	full = (int32_t *)plane;
+	i = 0;
+	while (depth == 2 && i < grid->size)
+	{
+		grid->z[i] = half[i];
+		i++;
+	}
+	while (depth == 4 && i < grid->size)
+	{
+		grid->z[i] = full[i];
+		i++;
+	}
+}
+
+// This function fills the grid from the planes of
+// the binary map, the coordinates being its indexes
+static void	binary_fill(t_grid *grid, t_binary *head, char *data)
+{
+	size_t	i;
+	int		x;
+	int		y;
+
+	unpack_heights(grid, data + sizeof(t_binary), head->depth);
+	if (head->colored)
+		ft_memcpy(grid->color, data + binary_colors(head),
+			sizeof(unsigned int) * grid->size);
+	i = 0;
+	y = -1;
+	while (++y < grid->height)
+	{
+		x = -1;
+		while (++x < grid->width)
+		{
+			if (!head->colored)
+				grid->color[i] = DEFAULT_COLOR;
+			grid->x[i] = x;
+			grid->y[i++] = y;
+		}
+	}
+}
+
+// Main function to load a binary map, the file is
+// mapped and its planes copied straight into the grid,
+// the bounds of its heights being kept from its header
+void	load_binary(char *file_name)
+{
+	t_map_file		file;
+	t_binary		*head;
+	struct timespec	start;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	ft_bzero(&file, sizeof(t_map_file));
+	map_file(file_name, &file, MADV_WILLNEED);
+	head = (t_binary *)file.data;
+	if (file.len < sizeof(t_binary) || !binary_check(head, file.len))
+	{
+		unmap_file(&file);
+		map_error("Binary map is invalid!");
+	}
+	if (!grid_alloc(&map()->grid, head->width, head->height))
+	{
+		unmap_file(&file);
+		malloc_error();
+	}
+	binary_fill(&map()->grid, head, file.data);
+	map()->coor->min_z = head->zmin;
+	map()->coor->max_z = head->zmax;
+	map()->coor->z_known = true;
+	unmap_file(&file);
+	report_load(file_name, file.len, elapsed_us(start));
+}
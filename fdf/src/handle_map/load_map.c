@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   load_map.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/21 11:02:36 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/21 11:02:36 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function adds a line of the file to the
+// rows to parse, lines with only blanks are skipped
+static int	add_row(t_map_file *file, char *begin, char *end)
+{
+	t_row	*new_rows;
+	char	*s;
+
+	s = begin;
+	while (s < end && is_blank(*s))
+		s++;
+	if (s == end)
+		return (1);
+	if (file->rows_amount == file->rows_capacity)
+	{
+		file->rows_capacity = file->rows_capacity * 2 + 64;
+		new_rows = (t_row *)malloc(sizeof(t_row) * file->rows_capacity);
+		if (!new_rows)
+			return (0);
+		if (file->rows)
+			ft_memcpy(new_rows, file->rows, sizeof(t_row) * file->rows_amount);
+		free(file->rows);
+		file->rows = new_rows;
+	}
+	file->rows[file->rows_amount].begin = begin;
+	file->rows[file->rows_amount++].end = end;
+	return (1);
+}
+
+// This function finds the boundaries of
+// every line of the file in a single sweep
+static int	split_rows(t_map_file *file)
+{
+	char	*begin;
+	char	*end;
+	char	*limit;
+
+	begin = file->data;
+	limit = file->data + file->len;
+	while (begin < limit)
+	{
+		end = memchr(begin, '\n', limit - begin);
+		if (!end)
+			end = limit;
+		if (!add_row(file, begin, end))
+			return (0);
+		begin = end + 1;
+	}
+	return (1);
+}
+
+// This function maps the whole file in memory,
+// the descriptor isn't needed after that
+void	map_file(char *file_name, t_map_file *file, int advice)
+{
+	struct stat	file_stat;
+	int			fd;
+
+	fd = handle_open(file_name);
+	if (fstat(fd, &file_stat) == -1 || file_stat.st_size == 0)
+	{
+		handle_close(fd);
+		map_error("Map is empty or can't be read!");
+	}
+	file->len = file_stat.st_size;
+	file->data = mmap(NULL, file->len, PROT_READ, MAP_PRIVATE, fd, 0);
+	handle_close(fd);
+	if (file->data == MAP_FAILED)
+		map_error("Map can't be mapped in memory!");
+	madvise(file->data, file->len, advice);
+}
+
+// This function maps the file and finds its rows, advice
+// telling the kernel how the file is going to be read
+void	open_map(char *file_name, t_map_file *file, int advice)
+{
+	ft_bzero(file, sizeof(t_map_file));
+	map_file(file_name, file, advice);
+	if (!split_rows(file))
+	{
+		unmap_file(file);
+		malloc_error();
+	}
+	if (!file->rows_amount)
+	{
+		unmap_file(file);
+		map_error("Map is empty!");
+	}
+}
+
+// Main function to load the map, the rows are
+// parsed in parallel straight into the grid
+void	load_map(char *file_name)
+{
+	t_map_file		file;
+	struct timespec	start;
+	int				status;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	open_map(file_name, &file, MADV_WILLNEED);
+	if (!grid_alloc(&map()->grid, count_elements(file.rows[0]),
+			file.rows_amount))
+	{
+		unmap_file(&file);
+		malloc_error();
+	}
+	status = parse_rows(&map()->grid, file.rows, file.rows_amount);
+	unmap_file(&file);
+	if (status == ROW_BAD_WIDTH)
+		map_error("Map rows have different lengths!");
+	else if (status == ROW_BAD_ELEMENT)
+		map_error("Map contains an invalid element!");
+	report_load(file_name, file.len, elapsed_us(start));
+}
@@ -12,27 +12,6 @@
 
 #include "fdf.h"
 
-// This function takes an array of strings
-// and converts the values of each element
-// into integers and put inside a node.
-int	convert_line_into_coordinates(char **array, int y)
-{
-	int	i;
-	int	x;
-
-	i = 0;
-	x = 0;
-	while (array[i])
-	{
-		if (*array[i] == '\n')
-			break ;
-		if (!build_node(array[i++], x++, y))
-			return (0);
-	}
-	map()->coor->max_x = x;
-	return (1);
-}
-
 // This function sets ranges of
 // all three axes, x, y, and z
 void	set_ranges(void)
@@ -63,45 +42,57 @@ void	get_scaling_factor(void)
 	map_ref->sf = fmin(ratio_width, ratio_height);
 }
 
-// This function calls the scale factor function
-// to recalculate the new pixel distribuition
-void	expand_map(void)
+// This function sets the bounds of the model, the
+// x and y axes are the columns and rows of the grid,
+// a streamed or binary map taking its heights from its
+// header, the others having them scanned
+void	set_model_bounds(void)
 {
-	t_node	*current;
-	t_node	*save;
+	t_grid	*grid;
+	t_coor	*coor;
+	size_t	i;
 
-	current = map()->head;
-	save = current;
-	while (current)
+	grid = &map()->grid;
+	coor = map()->coor;
+	coor->min_x = 0;
+	coor->max_x = grid->width - 1;
+	coor->min_y = 0;
+	coor->max_y = grid->height - 1;
+	if (coor->z_known)
+		return ;
+	coor->min_z = grid->z[0];
+	coor->max_z = grid->z[0];
+	i = 1;
+	while (i < grid->size)
 	{
-		current->x *= map()->sf / 1.6;
-		current->y *= map()->sf / 1.6;
-		current->z *= map()->sf / 1.6;
-		if (!current->east)
-		{
-			save = save->south;
-			current = save;
-		}
-		else
-			current = current->east;
+		if (grid->z[i] > coor->max_z)
+			coor->max_z = grid->z[i];
+		if (grid->z[i] < coor->min_z)
+			coor->min_z = grid->z[i];
+		i++;
 	}
 }
 
-// Main function to build the data structure
-void	get_matrix(char *file_name)
+// This function sets the starting view, the map
+// rotated, the first frame centering it on the screen
+void	view_init(void)
 {
-	int		fd;
+	view_reset();
+	view_rotate(1, -0.8, 0.2);
+}
 
-	fd = handle_open(file_name);
-	window_init();
-	generate_lines(fd);
-	handle_close(fd);
-	set_new_max_xy();
-	set_new_min_xy();
-	set_z_max_min();
+// Main function to build the data structure, a binary
+// map being copied and a tiled one streamed instead
+void	get_matrix(char *file_name)
+{
+	if (has_extension(file_name, ".fdft"))
+		stream_open(file_name);
+	else if (has_extension(file_name, ".fdfb"))
+		load_binary(file_name);
+	else
+		load_map(file_name);
+	lod_build();
+	set_model_bounds();
 	get_scaling_factor();
-	expand_map();
-	apply_rotation(1,
-		-0.8, 0.2);
-	center_map();
+	view_init();
 }
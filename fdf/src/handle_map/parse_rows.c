@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_rows.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/21 11:47:09 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/21 11:47:09 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function reads a color written as 0xRRGGBB,
+// it returns NULL if the color is malformed
+static char	*parse_color(char *s, char *end, unsigned int *color)
+{
+	char	*digits;
+
+	if (end - s < 3 || s[0] != '0' || (s[1] != 'x' && s[1] != 'X'))
+		return (NULL);
+	s += 2;
+	digits = s;
+	*color = 0;
+	while (s < end && hex_value(*s) >= 0)
+		*color = *color << 4 | hex_value(*s++);
+	if (s == digits || s - digits > 8)
+		return (NULL);
+	return (s);
+}
+
+// This function reads an altitude and its optional color
+// into the vertex i, it returns NULL if it is malformed
+static char	*parse_element(char *s, char *end, t_grid *grid, size_t i)
+{
+	long	value;
+	int		sign;
+	char	*digits;
+
+	sign = 1;
+	if (*s == '-')
+		sign = -1;
+	if (*s == '-' || *s == '+')
+		s++;
+	digits = s;
+	value = 0;
+	while (s < end && ft_isdigit(*s) && value <= INT32_MAX)
+		value = value * 10 + (*s++ - '0');
+	if (s == digits || sign * value < INT32_MIN || sign * value > INT32_MAX)
+		return (NULL);
+	grid->z[i] = sign * value;
+	grid->color[i] = DEFAULT_COLOR;
+	if (s < end && *s == ',')
+		s = parse_color(s + 1, end, &grid->color[i]);
+	if (s && s < end && !is_blank(*s))
+		return (NULL);
+	return (s);
+}
+
+// This function parses one row of the map into the grid,
+// checking it has as many elements as the first one
+static int	parse_row(t_row row, t_grid *grid, int y)
+{
+	char	*s;
+	size_t	i;
+	int		x;
+
+	s = row.begin;
+	i = (size_t)y * grid->width;
+	x = 0;
+	while (1)
+	{
+		while (s < row.end && is_blank(*s))
+			s++;
+		if (s == row.end)
+			break ;
+		if (x == grid->width)
+			return (ROW_BAD_WIDTH);
+		s = parse_element(s, row.end, grid, i + x);
+		if (!s)
+			return (ROW_BAD_ELEMENT);
+		grid->x[i + x] = x;
+		grid->y[i + x++] = y;
+	}
+	if (x != grid->width)
+		return (ROW_BAD_WIDTH);
+	return (ROW_OK);
+}
+
+// This function is the routine of a loader thread,
+// it stops at the first row that can't be parsed
+static void	*parse_rows_routine(void *arg)
+{
+	t_loader	*loader;
+	int			y;
+
+	loader = (t_loader *)arg;
+	y = loader->first;
+	while (y < loader->last && loader->status == ROW_OK)
+	{
+		loader->status = parse_row(loader->rows[y], loader->grid, y);
+		y++;
+	}
+	return (NULL);
+}
+
+// This function splits the rows between threads, each
+// one writing its share straight into the grid, the
+// first share being parsed by the calling thread, and
+// returns the worst status found
+int	parse_rows(t_grid *grid, t_row *rows, int rows_amount)
+{
+	t_loader	loaders[LOAD_THREADS];
+	int			threads;
+	int			status;
+	int			i;
+
+	threads = fmax(1, fmin(LOAD_THREADS, rows_amount / ROWS_PER_THREAD));
+	i = threads;
+	while (--i >= 0)
+	{
+		loaders[i] = (t_loader){rows, rows_amount * (long)i / threads,
+			rows_amount * (long)(i + 1) / threads, ROW_OK, 0, grid, 0};
+		loaders[i].threaded = i && !pthread_create(&loaders[i].thread, NULL,
+				parse_rows_routine, &loaders[i]);
+		if (!loaders[i].threaded)
+			parse_rows_routine(&loaders[i]);
+	}
+	status = ROW_OK;
+	while (++i < threads)
+	{
+		if (loaders[i].threaded)
+			pthread_join(loaders[i].thread, NULL);
+		if (loaders[i].status < status)
+			status = loaders[i].status;
+	}
+	return (status);
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/21 12:15:50 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/21 12:15:50 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function checks if the character
+// separates two elements of the map
+int	is_blank(char c)
+{
+	return (c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f');
+}
+
+// This function returns the value of
+// an hexadecimal digit or -1 if it isn't one
+int	hex_value(char c)
+{
+	if (c >= '0' && c <= '9')
+		return (c - '0');
+	if (c >= 'a' && c <= 'f')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'F')
+		return (c - 'A' + 10);
+	return (-1);
+}
+
+// This function counts the elements of a row
+int	count_elements(t_row row)
+{
+	int		count;
+	char	*s;
+
+	count = 0;
+	s = row.begin;
+	while (s < row.end)
+	{
+		while (s < row.end && is_blank(*s))
+			s++;
+		if (s < row.end)
+			count++;
+		while (s < row.end && !is_blank(*s))
+			s++;
+	}
+	return (count);
+}
+
+// This function releases the mapped file
+// and the boundaries of its rows
+void	unmap_file(t_map_file *file)
+{
+	munmap(file->data, file->len);
+	free(file->rows);
+	file->rows = NULL;
+}
+
+// This function displays the size of the map, how
+// long it took to load it and the throughput
+void	report_load(char *file_name, size_t bytes, long long us)
+{
+	unsigned int	rate;
+
+	if (us < 1)
+		us = 1;
+	rate = (unsigned int)((long long)bytes * 1000000 / us / (1024 * 1024));
+	ft_printf("Loaded %s: %dx%d, %u KB in ", file_name, map()->grid.width,
+		map()->grid.height, (unsigned int)(bytes / 1024));
+	put_ms(us);
+	ft_printf(" ms (%u MB/s)\n", rate);
+}
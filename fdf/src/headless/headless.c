@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   headless.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/30 09:41:26 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/30 09:41:26 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function sets up a window that only exists in
+// memory, with no display and no mlx, the frames being
+// drawn into a buffer of its size
+static void	headless_window(void)
+{
+	static t_win	window;
+
+	window.win_w = HEADLESS_W;
+	window.win_h = HEADLESS_H;
+	window.addr = malloc(sizeof(unsigned int) * HEADLESS_W * HEADLESS_H);
+	map()->win = &window;
+	if (!window.addr)
+		malloc_error();
+	map()->columns_amount = HEADLESS_W * sizeof(unsigned int);
+}
+
+// This function draws a frame of the current view into
+// the buffer, adding up the time spent projecting and
+// binning its edges apart from their rasterization
+void	headless_frame(t_headless *h)
+{
+	render_grid();
+	h->transform_us += map()->stats.transform_us;
+	h->raster_us += map()->stats.raster_us;
+	stats_frame();
+	stats_log();
+	if (h->prefix)
+		write_ppm(h->prefix, h->frames);
+	h->frames++;
+}
+
+// This function prints the times of a run, per frame
+// for the transform and the raster, and its peak memory
+static void	headless_report(char *file_name, t_headless *h)
+{
+	struct rusage	usage;
+
+	getrusage(RUSAGE_SELF, &usage);
+	ft_printf("%s: %d frames, load ", file_name, h->frames);
+	put_ms(h->load_us);
+	ft_printf(" ms, transform ");
+	put_ms(h->transform_us / h->frames);
+	ft_printf(" ms, raster ");
+	put_ms(h->raster_us / h->frames);
+	ft_printf(" ms, peak RSS %u KB\n", (unsigned int)usage.ru_maxrss);
+}
+
+// This function frees what a headless run allocated
+static void	headless_free(void)
+{
+	char	*pixels;
+
+	pixels = map()->win->addr;
+	free_project();
+	free_grid();
+	free(pixels);
+}
+
+// This function renders a map with no display: ./fdf
+// --headless map.fdf [script [ppm_prefix]], drawing the
+// first view and one frame per step of the script
+int	headless(int ac, char **av)
+{
+	static t_coor	coor;
+	struct timespec	start;
+	t_headless		h;
+
+	if (!file_name_checker(av[0]))
+		return (ft_putendl_fd("Error: File extension is invalid!", 2), 1);
+	ft_bzero(&h, sizeof(t_headless));
+	if (ac >= 3)
+		h.prefix = av[2];
+	map()->coor = &coor;
+	headless_window();
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	get_matrix(av[0]);
+	h.load_us = elapsed_us(start);
+	raster_init(&map()->raster, map()->win->addr, map()->columns_amount);
+	render_init();
+	headless_frame(&h);
+	if (ac >= 2 && !run_script(av[1], &h))
+	{
+		ft_putendl_fd("Error: Invalid script!", 2);
+		return (headless_free(), 1);
+	}
+	headless_report(av[0], &h);
+	headless_free();
+	return (0);
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ppm.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/30 11:08:13 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/30 11:08:13 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function opens prefix_NNNN.ppm for the frame
+static int	ppm_open(char *prefix, int frame)
+{
+	char	*name;
+	char	*number;
+	int		fd;
+	int		i;
+
+	number = ft_itoa(10000 + frame % 10000);
+	name = ft_strjoin(prefix, "_0000.ppm");
+	if (!number || !name)
+		return (free(number), free(name), -1);
+	i = -1;
+	while (++i < 4)
+		name[ft_strlen(prefix) + 1 + i] = number[i + 1];
+	fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	free(number);
+	free(name);
+	return (fd);
+}
+
+// This function writes the PPM header of the image
+static void	ppm_header(int fd)
+{
+	ft_putstr_fd("P6\n", fd);
+	ft_putnbr_fd(map()->win->win_w, fd);
+	ft_putchar_fd(' ', fd);
+	ft_putnbr_fd(map()->win->win_h, fd);
+	ft_putstr_fd("\n255\n", fd);
+}
+
+// This function turns a row of the image into RGB bytes
+static void	ppm_row(unsigned char *row, unsigned int *pixels)
+{
+	int	x;
+
+	x = -1;
+	while (++x < map()->win->win_w)
+	{
+		row[3 * x] = pixels[x] >> 16 & 0xFF;
+		row[3 * x + 1] = pixels[x] >> 8 & 0xFF;
+		row[3 * x + 2] = pixels[x] & 0xFF;
+	}
+}
+
+// This function writes the image of the last frame
+// to a binary PPM file, one row at a time
+void	write_ppm(char *prefix, int frame)
+{
+	unsigned char	*row;
+	int				fd;
+	int				y;
+
+	fd = ppm_open(prefix, frame);
+	if (fd < 0)
+		map_error("Can't write the frame!");
+	row = malloc(3 * map()->win->win_w);
+	if (!row)
+	{
+		handle_close(fd);
+		malloc_error();
+	}
+	ppm_header(fd);
+	y = -1;
+	while (++y < map()->win->win_h)
+	{
+		ppm_row(row, map()->raster.pixels + (size_t)y * map()->raster.stride);
+		write(fd, row, 3 * map()->win->win_w);
+	}
+	free(row);
+	handle_close(fd);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/30 10:27:55 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/30 10:27:55 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function reads a decimal number at the cursor and
+// moves the cursor past it, an empty number being 0
+static double	script_number(char **s)
+{
+	double	value;
+	double	unit;
+	int		sign;
+
+	sign = 1;
+	if (**s == '-' || **s == '+')
+		if (*(*s)++ == '-')
+			sign = -1;
+	value = 0;
+	while (ft_isdigit(**s))
+		value = value * 10 + *(*s)++ - '0';
+	unit = 1;
+	if (**s == '.')
+	{
+		(*s)++;
+		while (ft_isdigit(**s))
+		{
+			unit /= 10;
+			value += unit * (*(*s)++ - '0');
+		}
+	}
+	return (sign * value);
+}
+
+// This function applies a step of the script to the view:
+// x, y and z rotate it by value radians, s zooms it by
+// value, h and v move it by value pixels, f switches the
+// fill mode, a the anti-aliased lines, p the perspective
+// camera and r resets the view
+static int	script_apply(char op, double value)
+{
+	if (op == 'x' || op == 'y' || op == 'z')
+		view_rotate(value * (op == 'x'), value * (op == 'y'),
+			value * (op == 'z'));
+	else if (op == 's')
+		view_zoom(value);
+	else if (op == 'h' || op == 'v')
+		view_translate(value * (op == 'h'), value * (op == 'v'));
+	else if (op == 'f')
+		toggle_fill();
+	else if (op == 'a')
+		toggle_smooth();
+	else if (op == 'p')
+		toggle_perspective();
+	else if (op == 'r')
+		view_reset();
+	else
+		return (0);
+	return (1);
+}
+
+// This function runs a step of the script, an operation
+// and its value, repeated when followed by *count, each
+// repetition being drawn as a frame
+static int	script_step(char **s, t_headless *h)
+{
+	char	op;
+	double	value;
+	int		count;
+
+	op = *(*s)++;
+	value = script_number(s);
+	count = 1;
+	if (**s == '*')
+	{
+		(*s)++;
+		count = script_number(s);
+	}
+	while (count-- > 0)
+	{
+		if (!script_apply(op, value))
+			return (0);
+		headless_frame(h);
+	}
+	return (**s == ',' || !**s);
+}
+
+// This function runs a script of comma separated steps,
+// like "x0.1*10,s1.5,f", it returns 0 if it is invalid
+int	run_script(char *script, t_headless *h)
+{
+	while (*script)
+	{
+		if (!script_step(&script, h))
+			return (0);
+		if (*script == ',')
+			script++;
+	}
+	return (1);
+}
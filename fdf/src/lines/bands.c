@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bands.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/27 09:48:31 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/27 09:48:31 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function points the raster to the image of the window
+// and splits the image in horizontal bands, one per
+// render thread, each band owning its rows
+void	raster_init(t_raster *raster, char *addr, int line_len)
+{
+	t_render	*render;
+	int			i;
+
+	render = &map()->render;
+	raster->pixels = (unsigned int *)addr;
+	raster->stride = line_len / sizeof(unsigned int);
+	raster->depth = (float *)malloc(sizeof(float) * raster->stride
+			* map()->win->win_h);
+	if (!raster->depth)
+		malloc_error();
+	raster->clip = (t_clip){0, 0, map()->win->win_w - 1,
+		map()->win->win_h - 1};
+	raster->row_min = 0;
+	raster->row_max = map()->win->win_h - 1;
+	render->band_h = (map()->win->win_h + RENDER_THREADS - 1) / RENDER_THREADS;
+	i = -1;
+	while (++i < RENDER_THREADS)
+	{
+		render->bands[i].raster = *raster;
+		render->bands[i].raster.row_min = i * render->band_h;
+		render->bands[i].raster.row_max = (i + 1) * render->band_h - 1;
+		if (render->bands[i].raster.row_max > raster->row_max)
+			render->bands[i].raster.row_max = raster->row_max;
+	}
+}
+
+// This function clears the pixels of the rows of the
+// band and in fill mode the depth of its faces
+static void	band_clear(t_raster *raster, int rows)
+{
+	size_t	i;
+	size_t	last;
+
+	memset(raster->pixels + (size_t)raster->row_min * raster->stride, 0,
+		sizeof(unsigned int) * rows * raster->stride);
+	if (!map()->fill)
+		return ;
+	i = (size_t)raster->row_min * raster->stride;
+	last = i + (size_t)rows * raster->stride;
+	while (i < last)
+		raster->depth[i++] = -INFINITY;
+}
+
+// This function clears the rows of the band and draws
+// its edges or faces, no other thread ever writes to them
+void	band_draw(t_band *band)
+{
+	size_t	i;
+	int		rows;
+
+	rows = band->raster.row_max - band->raster.row_min + 1;
+	if (rows <= 0)
+		return ;
+	band_clear(&band->raster, rows);
+	i = 0;
+	while (!map()->fill && i < band->count)
+		draw_edge(&band->raster, band->edges[i++]);
+	while (map()->fill && i + 2 < band->count)
+	{
+		face_draw(&band->raster, band->edges + i);
+		i += 3;
+	}
+}
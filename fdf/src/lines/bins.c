@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bins.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/29 10:17:44 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/29 10:17:44 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function adds an edge to the bin of a band
+static void	band_push(t_band *band, size_t edge)
+{
+	size_t	*new_edges;
+
+	if (band->count == band->capacity)
+	{
+		band->capacity = band->capacity * 2 + 1024;
+		new_edges = (size_t *)malloc(sizeof(size_t) * band->capacity);
+		if (!new_edges)
+			malloc_error();
+		if (band->edges)
+			ft_memcpy(new_edges, band->edges, sizeof(size_t) * band->count);
+		free(band->edges);
+		band->edges = new_edges;
+	}
+	band->edges[band->count++] = edge;
+}
+
+// This function keeps a segment cut by the near plane for
+// the frame and returns its index, its edge being binned
+// as that index with EDGE_CUT set
+size_t	cut_push(t_render *render, t_segment *s)
+{
+	t_segment	*new_cuts;
+
+	if (render->cut_count == render->cut_capacity)
+	{
+		render->cut_capacity = render->cut_capacity * 2 + 256;
+		new_cuts = (t_segment *)malloc(sizeof(t_segment)
+				* render->cut_capacity);
+		if (!new_cuts)
+			malloc_error();
+		if (render->cuts)
+			ft_memcpy(new_cuts, render->cuts,
+				sizeof(t_segment) * render->cut_count);
+		free(render->cuts);
+		render->cuts = new_cuts;
+	}
+	render->cuts[render->cut_count] = *s;
+	return (render->cut_count++);
+}
+
+// This function adds an edge to the bins of every band
+// the rows [top, bottom] cross, within the window
+void	bin_span(t_render *render, int top, int bottom, size_t edge)
+{
+	if (bottom < 0 || top >= map()->win->win_h)
+		return ;
+	if (top < 0)
+		top = 0;
+	if (bottom >= map()->win->win_h)
+		bottom = map()->win->win_h - 1;
+	top /= render->band_h;
+	while (top <= bottom / render->band_h)
+		band_push(&render->bands[top++], edge);
+}
+
+// This function adds the edge between two projected
+// vertices to the bins of every band its rows cross, an
+// anti-aliased one reaching a row further down; edges off
+// the screen are dropped and those the near plane crosses
+// cut
+void	bin_edge(t_render *render, size_t first, size_t second)
+{
+	t_grid	*grid;
+
+	grid = &map()->grid;
+	if (map()->view.perspective
+		&& (grid->depth[first] < 0 || grid->depth[second] < 0))
+		bin_cut(render, first, second);
+	else if (edge_kept(grid, first, second))
+		bin_span(render, fmin(grid->sy[first], grid->sy[second]),
+			fmax(grid->sy[first], grid->sy[second]) + map()->smooth,
+			first | (second - first) << EDGE_OFFSET_SHIFT);
+}
+
+// This function adds a face to the bins of every band
+// its rows cross, faces off the screen or crossing the
+// near plane are dropped and counted as clipped
+void	bin_face(t_render *render, size_t a, size_t b, size_t c)
+{
+	t_grid	*grid;
+	int		top;
+	int		bottom;
+
+	grid = &map()->grid;
+	top = fmin(fmin(grid->sy[a], grid->sy[b]), grid->sy[c]);
+	bottom = fmax(fmax(grid->sy[a], grid->sy[b]), grid->sy[c]);
+	if (bottom < 0 || top >= map()->win->win_h
+		|| fmax(fmax(grid->sx[a], grid->sx[b]), grid->sx[c]) < 0
+		|| fmin(fmin(grid->sx[a], grid->sx[b]), grid->sx[c])
+		>= map()->win->win_w || (map()->view.perspective
+			&& fmin(fmin(grid->depth[a], grid->depth[b]), grid->depth[c]) < 0))
+	{
+		map()->stats.clipped++;
+		return ;
+	}
+	map()->stats.segments++;
+	top = fmax(top, 0) / render->band_h;
+	bottom = fmin(bottom, map()->win->win_h - 1) / render->band_h;
+	while (top <= bottom)
+	{
+		band_push(&render->bands[top], a);
+		band_push(&render->bands[top], b);
+		band_push(&render->bands[top++], c);
+	}
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   clip.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/26 11:40:02 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/26 11:40:02 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function tells on which sides of the clip
+// rectangle a pixel lies, 0 meaning inside it
+static int	outcode(t_clip *clip, int x, int y)
+{
+	int	code;
+
+	code = 0;
+	if (x < clip->min_x)
+		code |= CLIP_LEFT;
+	else if (x > clip->max_x)
+		code |= CLIP_RIGHT;
+	if (y < clip->min_y)
+		code |= CLIP_TOP;
+	else if (y > clip->max_y)
+		code |= CLIP_BOTTOM;
+	return (code);
+}
+
+// This function narrows the [t0, t1] range of the segment
+// kept by one edge of the rectangle, it returns 0 when
+// nothing of the segment is left
+static int	clip_edge(double p, double q, double t[2])
+{
+	double	r;
+
+	if (p == 0)
+		return (q >= 0);
+	r = q / p;
+	if (p < 0 && r > t[1])
+		return (0);
+	if (p > 0 && r < t[0])
+		return (0);
+	if (p < 0 && r > t[0])
+		t[0] = r;
+	if (p > 0 && r < t[1])
+		t[1] = r;
+	return (1);
+}
+
+static int	clamp(int value, int min, int max)
+{
+	if (value < min)
+		return (min);
+	if (value > max)
+		return (max);
+	return (value);
+}
+
+// This function moves both ends of the segment to the
+// parameters t, rounding can't take them out of the
+// rectangle since they are clamped back into it
+static void	clip_ends(t_clip *clip, t_segment *s, double t[2])
+{
+	t_segment	in;
+	int			i;
+
+	in = *s;
+	i = -1;
+	while (++i < 2)
+	{
+		s->x[i] = clamp(lround(in.x[0] + t[i] * ((double)in.x[1] - in.x[0])),
+				clip->min_x, clip->max_x);
+		s->y[i] = clamp(lround(in.y[0] + t[i] * ((double)in.y[1] - in.y[0])),
+				clip->min_y, clip->max_y);
+		s->color[i] = line_color(in.color[0], in.color[1], t[i]);
+	}
+}
+
+// This function clips the segment to the rectangle: the
+// outcodes accept or reject most segments right away,
+// Liang-Barsky cuts the ones crossing an edge
+int	clip_segment(t_clip *clip, t_segment *s)
+{
+	int		code[2];
+	double	d[2];
+	double	t[2];
+
+	code[0] = outcode(clip, s->x[0], s->y[0]);
+	code[1] = outcode(clip, s->x[1], s->y[1]);
+	if (!(code[0] | code[1]))
+		return (1);
+	if (code[0] & code[1])
+		return (0);
+	d[0] = (double)s->x[1] - s->x[0];
+	d[1] = (double)s->y[1] - s->y[0];
+	t[0] = 0;
+	t[1] = 1;
+	if (!clip_edge(-d[0], s->x[0] - clip->min_x, t)
+		|| !clip_edge(d[0], clip->max_x - s->x[0], t)
+		|| !clip_edge(-d[1], s->y[0] - clip->min_y, t)
+		|| !clip_edge(d[1], clip->max_y - s->y[0], t))
+		return (0);
+	clip_ends(clip, s, t);
+	return (1);
+}
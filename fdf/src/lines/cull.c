@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cull.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/11/06 15:26:10 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/11/06 15:26:10 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function tells whether a projected vertex
+// lies out of the window
+static bool	vertex_out(t_grid *grid, size_t i)
+{
+	return (grid->sx[i] < 0 || grid->sx[i] >= map()->win->win_w
+		|| grid->sy[i] < 0 || grid->sy[i] >= map()->win->win_h);
+}
+
+// This function tells whether the edge between two
+// projected vertices reaches the window, an anti-aliased
+// one reaching a row further down, and counts it as drawn
+// and as clipped when the window cuts or culls it
+bool	edge_kept(t_grid *grid, size_t first, size_t second)
+{
+	t_stats	*stats;
+
+	stats = &map()->stats;
+	if (!vertex_out(grid, first) && !vertex_out(grid, second))
+		return (stats->segments++, true);
+	stats->clipped++;
+	if (fmax(grid->sy[first], grid->sy[second]) + map()->smooth < 0
+		|| fmin(grid->sy[first], grid->sy[second]) >= map()->win->win_h
+		|| (grid->sx[first] < 0 && grid->sx[second] < 0)
+		|| (grid->sx[first] >= map()->win->win_w
+			&& grid->sx[second] >= map()->win->win_w))
+		return (false);
+	return (stats->segments++, true);
+}
+
+// This function computes x, y and w of the vertex i,
+// before the division by w
+static void	homogeneous(t_transform *tf, size_t i, double h[3])
+{
+	t_grid	*grid;
+	int		k;
+	int		r;
+
+	grid = &map()->grid;
+	k = -1;
+	while (++k < 3)
+	{
+		r = k + (k == 2);
+		h[k] = (double)tf->m[r][0] * grid->x[i] + (double)tf->m[r][1]
+			* grid->y[i] + (double)tf->m[r][2] * grid->z[i] + tf->t[r];
+	}
+}
+
+// This function cuts the edge between two vertices, the
+// second one behind the near plane, where it crosses the
+// plane: the cut is done on their homogeneous coordinates,
+// as the division by w means nothing behind the camera
+static void	near_segment(t_transform *tf, size_t v[2], t_segment *s)
+{
+	t_grid	*grid;
+	double	h[2][3];
+	double	t;
+	int		k;
+
+	grid = &map()->grid;
+	homogeneous(tf, v[0], h[0]);
+	homogeneous(tf, v[1], h[1]);
+	t = 1;
+	if (h[0][2] != h[1][2])
+		t = fmin(fmax((h[0][2] - CAMERA_NEAR) / (h[0][2] - h[1][2]), 0), 1);
+	k = -1;
+	while (++k < 2)
+		h[1][k] = (h[0][k] + t * (h[1][k] - h[0][k])) / CAMERA_NEAR;
+	*s = (t_segment){{grid->sx[v[0]],
+		fmin(fmax(h[1][0], -SCREEN_CLAMP), SCREEN_CLAMP)},
+	{grid->sy[v[0]], fmin(fmax(h[1][1], -SCREEN_CLAMP), SCREEN_CLAMP)},
+	{grid->color[v[0]], line_color(grid->color[v[0]], grid->color[v[1]],
+			t)}};
+}
+
+// This function bins an edge the near plane crosses: it is
+// dropped when both its vertices are behind the plane, or
+// cut where it crosses it and kept in screen space for the
+// frame otherwise
+void	bin_cut(t_render *render, size_t first, size_t second)
+{
+	t_segment	s;
+	size_t		v[2];
+
+	map()->stats.clipped++;
+	if (map()->grid.depth[first] < 0 && map()->grid.depth[second] < 0)
+		return ;
+	v[0] = first;
+	v[1] = second;
+	if (map()->grid.depth[first] < 0)
+	{
+		v[0] = second;
+		v[1] = first;
+	}
+	near_segment(render->tf, v, &s);
+	map()->stats.segments++;
+	bin_span(render, fmin(s.y[0], s.y[1]), fmax(s.y[0], s.y[1])
+		+ map()->smooth, cut_push(render, &s) | EDGE_CUT);
+}
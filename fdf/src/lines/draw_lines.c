@@ -29,83 +29,53 @@ int	line_color(int first_color, int second_color, float delta)
 	return (color[0] << 16 | color[1] << 8 | color[2]);
 }
 
-// This function draws a line, pixel by pixel
-// starting from the first node to the second
-void	draw_line(t_node *first, t_node *second)
+// This function draws an edge of the map, coded as its
+// first vertex and the offset to the second one or as a
+// segment the near plane cut, aliased or anti-aliased
+void	draw_edge(t_raster *raster, size_t edge)
 {
-	double	steps;
-	double	max_steps;
-	int		pixel_color;
-	float	ratio;
+	t_grid		*grid;
+	t_segment	segment;
+	size_t		first;
+	size_t		second;
 
-	map()->coor->delta_x = second->x - first->x;
-	map()->coor->delta_y = second->y - first->y;
-	if (fabs((double)map()->coor->delta_x)
-		<= fabs((double)map()->coor->delta_y))
-		max_steps = fabs((double)map()->coor->delta_y);
+	grid = &map()->grid;
+	if (edge & EDGE_CUT)
+		segment = map()->render.cuts[edge & ~EDGE_CUT];
 	else
-		max_steps = fabs((double)map()->coor->delta_x);
-	map()->coor->x = first->x;
-	map()->coor->y = first->y;
-	steps = 0;
-	while (++steps <= max_steps)
 	{
-		ratio = steps / max_steps;
-		pixel_color = line_color(first->color, second->color, ratio);
-		put_pixel(map()->coor->x, map()->coor->y, pixel_color);
-		map()->coor->x += (map()->coor->delta_x / max_steps);
-		map()->coor->y += (map()->coor->delta_y / max_steps);
-	}
-}
-
-// This function draws horizontal lines
-void	draw_horizontal_lines(void)
-{
-	t_node	*head;
-	t_node	*save;
-	t_node	*prev;
-
-	head = map()->head;
-	save = head;
-	while (head)
-	{
-		prev = head;
-		while (head)
-		{
-			if (head->east)
-				head = head->east;
-			else
-				break ;
-			draw_line(prev, head);
-			prev = head;
-		}
-		head = save->south;
-		save = head;
+		first = edge & EDGE_FIRST_MASK;
+		second = first + (edge >> EDGE_OFFSET_SHIFT);
+		segment = (t_segment){{grid->sx[first], grid->sx[second]},
+		{grid->sy[first], grid->sy[second]},
+		{grid->color[first], grid->color[second]}};
 	}
+	if (map()->smooth)
+		draw_smooth(raster, &segment);
+	else
+		draw_segment(raster, &segment);
 }
 
-// This function draws vertical lines
-void	draw_vertical_lines(void)
+// This function renders the map: the projection is centered
+// if the view asks it, the window of a streamed map is
+// moved under the view, the level of detail of its tiles
+// is picked, the vertices it keeps are projected, their
+// edges sorted into the bands of the image and the bands
+// drawn in parallel, both halves being timed
+void	render_grid(void)
 {
-	t_node	*head;
-	t_node	*save;
-	t_node	*prev;
+	struct timespec	start;
+	t_transform		tf;
 
-	head = map()->head;
-	save = head;
-	while (head)
-	{
-		prev = head;
-		while (head)
-		{
-			if (head->south)
-				head = head->south;
-			else
-				break ;
-			draw_line(prev, head);
-			prev = head;
-		}
-		head = save->east;
-		save = head;
-	}
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	if (map()->view.recenter)
+		view_center();
+	view_transform(&map()->view, &tf);
+	stream_follow(&tf);
+	lod_select(&tf);
+	lod_bin(&tf);
+	map()->stats.transform_us = elapsed_us(start);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	render_bands();
+	map()->stats.raster_us = elapsed_us(start);
 }
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   face.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/29 10:52:03 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/29 10:52:03 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function returns how much light a face gets in
+// perspective, from its normal in the model and the axis
+// of the camera, as the depth there is 1 / w
+static float	camera_light(t_grid *grid, size_t *v)
+{
+	double	e[2][3];
+	double	n[3];
+	double	*axis;
+	double	len;
+	int		i;
+
+	axis = map()->view.rot[2];
+	i = -1;
+	while (++i < 2)
+	{
+		e[i][0] = grid->x[v[i + 1]] - grid->x[v[0]];
+		e[i][1] = grid->y[v[i + 1]] - grid->y[v[0]];
+		e[i][2] = grid->z[v[i + 1]] - grid->z[v[0]];
+	}
+	n[0] = e[0][1] * e[1][2] - e[0][2] * e[1][1];
+	n[1] = e[0][2] * e[1][0] - e[0][0] * e[1][2];
+	n[2] = e[0][0] * e[1][1] - e[0][1] * e[1][0];
+	len = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+	if (len == 0)
+		return (1);
+	return (FILL_AMBIENT + (1 - FILL_AMBIENT)
+		* fabs(n[0] * axis[0] + n[1] * axis[1] + n[2] * axis[2]) / len);
+}
+
+// This function returns how much light a face gets from
+// a light shining out of the screen, the more it faces
+// the screen the brighter it is
+static float	face_light(t_grid *grid, size_t *v)
+{
+	double	e[2][3];
+	double	n[3];
+	double	len;
+	int		i;
+
+	if (map()->view.perspective)
+		return (camera_light(grid, v));
+	i = -1;
+	while (++i < 2)
+	{
+		e[i][0] = grid->sx[v[i + 1]] - grid->sx[v[0]];
+		e[i][1] = grid->sy[v[i + 1]] - grid->sy[v[0]];
+		e[i][2] = grid->depth[v[i + 1]] - grid->depth[v[0]];
+	}
+	n[0] = e[0][1] * e[1][2] - e[0][2] * e[1][1];
+	n[1] = e[0][2] * e[1][0] - e[0][0] * e[1][2];
+	n[2] = e[0][0] * e[1][1] - e[0][1] * e[1][0];
+	len = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+	if (len == 0)
+		return (1);
+	return (FILL_AMBIENT + (1 - FILL_AMBIENT) * fabs(n[2]) / len);
+}
+
+// This function sets the corner k of a face to the vertex v,
+// its color being darker the lower the vertex is
+static void	face_vertex(t_face *f, int k, size_t v, float light)
+{
+	t_grid	*grid;
+	t_coor	*coor;
+	float	shade;
+
+	grid = &map()->grid;
+	coor = map()->coor;
+	shade = light;
+	if (coor->max_z > coor->min_z)
+		shade *= FILL_LOW + (1 - FILL_LOW) * (grid->z[v] - coor->min_z)
+			/ (coor->max_z - coor->min_z);
+	f->x[k] = grid->sx[v];
+	f->y[k] = grid->sy[v];
+	f->a[0][k] = grid->depth[v];
+	f->a[1][k] = (grid->color[v] >> 16 & 0xFF) * shade;
+	f->a[2][k] = (grid->color[v] >> 8 & 0xFF) * shade;
+	f->a[3][k] = (grid->color[v] & 0xFF) * shade;
+}
+
+// This function sets up a face of the vertices v and the
+// gradients of its depth and colors, it returns false when
+// the face covers no area on the screen
+bool	face_init(t_face *f, t_grid *grid, size_t *v)
+{
+	double	det;
+	float	light;
+	int		i;
+
+	det = (double)(grid->sx[v[1]] - grid->sx[v[0]])
+		*(grid->sy[v[2]] - grid->sy[v[0]])
+		- (double)(grid->sx[v[2]] - grid->sx[v[0]])
+		*(grid->sy[v[1]] - grid->sy[v[0]]);
+	if (det == 0)
+		return (false);
+	light = face_light(grid, v);
+	i = -1;
+	while (++i < 3)
+		face_vertex(f, i, v[i], light);
+	i = -1;
+	while (++i < 4)
+	{
+		f->dx[i] = ((f->a[i][1] - f->a[i][0]) * (f->y[2] - f->y[0])
+				- (f->a[i][2] - f->a[i][0]) * (f->y[1] - f->y[0])) / det;
+		f->dy[i] = ((f->x[1] - f->x[0]) * (f->a[i][2] - f->a[i][0])
+				- (f->x[2] - f->x[0]) * (f->a[i][1] - f->a[i][0])) / det;
+	}
+	return (true);
+}
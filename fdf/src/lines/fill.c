@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fill.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/29 11:34:27 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/29 11:34:27 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function finds where the row y crosses the edge i of
+// a face, an edge holding the rows [top, bottom) and being
+// walked from its top so the faces sharing it never cover
+// the same pixel twice nor leave a hole
+static bool	edge_cross(t_face *f, int i, int y, double *x)
+{
+	int	t;
+	int	b;
+
+	t = i;
+	b = (i + 1) % 3;
+	if (f->y[b] < f->y[t])
+	{
+		t = b;
+		b = i;
+	}
+	if (y < f->y[t] || y >= f->y[b])
+		return (false);
+	*x = f->x[t] + (y - f->y[t]) * (f->x[b] - f->x[t]) / (f->y[b] - f->y[t]);
+	return (true);
+}
+
+// This function finds the part of the row y inside the face
+static bool	face_span(t_face *f, int y, double span[2])
+{
+	double	x;
+	int		i;
+
+	span[0] = INFINITY;
+	span[1] = -INFINITY;
+	i = -1;
+	while (++i < 3)
+	{
+		if (edge_cross(f, i, y, &x))
+		{
+			span[0] = fmin(span[0], x);
+			span[1] = fmax(span[1], x);
+		}
+	}
+	return (span[0] < span[1]);
+}
+
+// This function fills the pixels [left, right) of a row
+// of the face that are closer than what was drawn there
+static void	face_row(t_raster *raster, t_face *f, int y, double span[2])
+{
+	float	a[4];
+	size_t	i;
+	int		x;
+	int		last;
+	int		k;
+
+	x = fmax(ceil(span[0]), raster->clip.min_x);
+	last = fmin(ceil(span[1]) - 1, raster->clip.max_x);
+	k = -1;
+	while (++k < 4)
+		a[k] = f->a[k][0] + f->dx[k] * (x - f->x[0])
+			+ f->dy[k] * (y - f->y[0]);
+	i = (size_t)y * raster->stride + x;
+	while (x++ <= last)
+	{
+		if (a[0] > raster->depth[i])
+		{
+			raster->depth[i] = a[0];
+			raster->pixels[i] = (int)a[1] << 16 | (int)a[2] << 8 | (int)a[3];
+		}
+		k = -1;
+		while (++k < 4)
+			a[k] += f->dx[k];
+		i++;
+	}
+}
+
+// This function fills the rows of the band a face of the
+// vertices v covers, keeping the pixels closest to the screen
+void	face_draw(t_raster *raster, size_t *v)
+{
+	t_face	f;
+	double	span[2];
+	int		y;
+	int		last;
+
+	if (!face_init(&f, &map()->grid, v))
+		return ;
+	y = fmax(fmin(fmin(f.y[0], f.y[1]), f.y[2]),
+			fmax(raster->row_min, raster->clip.min_y));
+	last = fmin(fmax(fmax(f.y[0], f.y[1]), f.y[2]) - 1,
+			fmin(raster->row_max, raster->clip.max_y));
+	while (y <= last)
+	{
+		if (face_span(&f, y, span))
+			face_row(raster, &f, y, span);
+		y++;
+	}
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lod_bin.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/29 15:20:38 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/29 15:20:38 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function projects the rows of a visible tile its
+// step keeps, the last one included
+static void	project_tile(t_transform *tf, int tx, int ty)
+{
+	t_grid	*grid;
+	t_tile	t;
+	int		y;
+
+	grid = &map()->grid;
+	lod_tile(&t, tx, ty);
+	y = t.y0;
+	while (y < t.y1)
+	{
+		project_block(tf, grid, (size_t)y * grid->width + t.x0,
+			t.x1 - t.x0 + 1);
+		map()->stats.vertices += t.x1 - t.x0 + 1;
+		y += t.step;
+	}
+	map()->stats.vertices += t.x1 - t.x0 + 1;
+	project_block(tf, grid, (size_t)t.y1 * grid->width + t.x0,
+		t.x1 - t.x0 + 1);
+}
+
+// This function bins the edges or the faces of a visible tile
+static void	bin_tile(t_transform *tf, int tx, int ty)
+{
+	t_tile	t;
+
+	lod_tile(&t, tx, ty);
+	if (map()->fill)
+		emit_faces(tf, &t, tx, ty);
+	else
+		emit_edges(&t, tx, ty);
+}
+
+// This function projects the vertices the level of detail
+// of each visible tile keeps and sorts their edges into
+// the bands of the image, every tile being projected first
+// as the borders of a tile use the vertices of its neighbours;
+// the edges the near plane cut are kept for the frame
+void	lod_bin(t_transform *tf)
+{
+	t_lod	*lod;
+	int		i;
+
+	lod = &map()->lod;
+	map()->render.tf = tf;
+	map()->render.cut_count = 0;
+	map()->stats.vertices = 0;
+	map()->stats.segments = 0;
+	map()->stats.clipped = 0;
+	i = -1;
+	while (++i < RENDER_THREADS)
+		map()->render.bands[i].count = 0;
+	i = -1;
+	while (++i < lod->tiles_w * lod->tiles_h)
+		if (lod->step[i])
+			project_tile(tf, i % lod->tiles_w, i / lod->tiles_w);
+	i = -1;
+	while (++i < lod->tiles_w * lod->tiles_h)
+		if (lod->step[i])
+			bin_tile(tf, i % lod->tiles_w, i / lod->tiles_w);
+	if (map()->grid.size == 1 && lod->step[0] && !map()->fill)
+		bin_edge(&map()->render, 0, 0);
+}
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lod_edges.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/28 14:21:06 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/28 14:21:06 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function bins the edges along cells cells from the
+// vertex first, stride apart, picking a vertex every step
+// cells and the last one of the run
+static void	emit_run(size_t first, size_t stride, int cells, int step)
+{
+	t_render	*render;
+	int			k;
+
+	render = &map()->render;
+	k = 0;
+	while (k + step <= cells)
+	{
+		bin_edge(render, first + k * stride, first + (k + step) * stride);
+		k += step;
+	}
+	if (k < cells)
+		bin_edge(render, first + k * stride, first + cells * stride);
+}
+
+// This function bins the rows of a tile, its top border
+// being drawn at the finer step of the tile and the one
+// above so no line ends in the middle of nowhere
+static void	emit_rows(t_tile *t, int tx, int ty)
+{
+	size_t	w;
+	int		border;
+	int		y;
+
+	w = map()->grid.width;
+	border = lod_step(tx, ty - 1);
+	if (!border || border > t->step)
+		border = t->step;
+	emit_run(t->y0 * w + t->x0, 1, t->x1 - t->x0, border);
+	y = t->y0 + t->step;
+	while (y < t->y1)
+	{
+		emit_run(y * w + t->x0, 1, t->x1 - t->x0, t->step);
+		y += t->step;
+	}
+	if (t->y1 > t->y0 && !lod_step(tx, ty + 1))
+		emit_run(t->y1 * w + t->x0, 1, t->x1 - t->x0, t->step);
+}
+
+// This function bins the columns of a tile, its left
+// border being drawn at the finer step of the tile and
+// the one on its left
+static void	emit_cols(t_tile *t, int tx, int ty)
+{
+	size_t	w;
+	int		border;
+	int		x;
+
+	w = map()->grid.width;
+	border = lod_step(tx - 1, ty);
+	if (!border || border > t->step)
+		border = t->step;
+	emit_run(t->y0 * w + t->x0, w, t->y1 - t->y0, border);
+	x = t->x0 + t->step;
+	while (x < t->x1)
+	{
+		emit_run(t->y0 * w + x, w, t->y1 - t->y0, t->step);
+		x += t->step;
+	}
+	if (t->x1 > t->x0 && !lod_step(tx + 1, ty))
+		emit_run(t->y0 * w + t->x1, w, t->y1 - t->y0, t->step);
+}
+
+// This function bins the edges of a visible tile, a tile
+// owns its top and left borders and the others when no
+// visible tile does
+void	emit_edges(t_tile *t, int tx, int ty)
+{
+	emit_rows(t, tx, ty);
+	emit_cols(t, tx, ty);
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lod_faces.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/29 14:05:12 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/29 14:05:12 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function bins the fan of faces from the hub to
+// the side [ends[0], ends[1]] of a cell, its vertices
+// being picked every step vertices, stride apart
+static void	fan_side(size_t hub, size_t ends[2], size_t stride, int step)
+{
+	t_render	*render;
+	size_t		v;
+
+	render = &map()->render;
+	v = ends[0];
+	while (v + step * stride < ends[1])
+	{
+		bin_face(render, hub, v, v + step * stride);
+		v += step * stride;
+	}
+	bin_face(render, hub, v, ends[1]);
+}
+
+// This function bins the faces of a cell, split in two
+// faces when none of its sides is shared with a finer
+// tile, or in a fan around its middle vertex otherwise
+static void	bin_cell(t_transform *tf, t_tile *c, int side[4])
+{
+	t_grid	*grid;
+	size_t	w;
+	size_t	hub;
+
+	grid = &map()->grid;
+	w = grid->width;
+	if (side[0] >= c->x1 - c->x0 && side[2] >= c->x1 - c->x0
+		&& side[1] >= c->y1 - c->y0 && side[3] >= c->y1 - c->y0)
+	{
+		bin_face(&map()->render, c->y0 * w + c->x0, c->y0 * w + c->x1,
+			c->y1 * w + c->x1);
+		bin_face(&map()->render, c->y0 * w + c->x0, c->y1 * w + c->x1,
+			c->y1 * w + c->x0);
+		return ;
+	}
+	hub = (c->y0 + (c->y1 - c->y0) / 2) * w + c->x0 + (c->x1 - c->x0) / 2;
+	project_block(tf, grid, hub, 1);
+	fan_side(hub, (size_t [2]){c->y0 * w + c->x0, c->y0 * w + c->x1},
+		1, side[0]);
+	fan_side(hub, (size_t [2]){c->y0 * w + c->x1, c->y1 * w + c->x1},
+		w, side[1]);
+	fan_side(hub, (size_t [2]){c->y1 * w + c->x0, c->y1 * w + c->x1},
+		1, side[2]);
+	fan_side(hub, (size_t [2]){c->y0 * w + c->x0, c->y1 * w + c->x0},
+		w, side[3]);
+}
+
+// This function finds the step each border of a tile is
+// drawn at, the finer of the tile and its visible neighbour
+// on that side, top, right, bottom and left
+static void	tile_borders(t_tile *t, int tx, int ty, int border[4])
+{
+	int	k;
+
+	border[0] = lod_step(tx, ty - 1);
+	border[1] = lod_step(tx + 1, ty);
+	border[2] = lod_step(tx, ty + 1);
+	border[3] = lod_step(tx - 1, ty);
+	k = -1;
+	while (++k < 4)
+		if (!border[k] || border[k] > t->step)
+			border[k] = t->step;
+}
+
+// This function finds the step the sides of a cell of the
+// tile are drawn at, finer along the borders of the tile
+static void	cell_sides(t_tile *t, t_tile *c, int border[4], int side[4])
+{
+	side[0] = t->step;
+	side[1] = t->step;
+	side[2] = t->step;
+	side[3] = t->step;
+	if (c->y0 == t->y0)
+		side[0] = border[0];
+	if (c->x1 == t->x1)
+		side[1] = border[1];
+	if (c->y1 == t->y1)
+		side[2] = border[2];
+	if (c->x0 == t->x0)
+		side[3] = border[3];
+}
+
+// This function bins the faces of the cells of a visible
+// tile, the cells on its borders matching the finer
+// neighbours so the surface has no cracks where the
+// level changes
+void	emit_faces(t_transform *tf, t_tile *t, int tx, int ty)
+{
+	t_tile	c;
+	int		border[4];
+	int		side[4];
+
+	if (t->x1 == t->x0 || t->y1 == t->y0)
+		return ;
+	tile_borders(t, tx, ty, border);
+	c.y0 = t->y0;
+	while (c.y0 < t->y1)
+	{
+		c.y1 = fmin(c.y0 + t->step, t->y1);
+		c.x0 = t->x0;
+		while (c.x0 < t->x1)
+		{
+			c.x1 = fmin(c.x0 + t->step, t->x1);
+			cell_sides(t, &c, border, side);
+			bin_cell(tf, &c, side);
+			c.x0 = c.x1;
+		}
+		c.y0 = c.y1;
+	}
+}
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   raster.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/26 10:15:47 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/26 10:15:47 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function sets up the walk of the segment: both
+// coordinates and the channels of the color are 16.16
+// fixed point values moved by a constant step, the
+// position at any step is known without walking to it
+void	line_init(t_line *line, t_segment *s)
+{
+	int	shift;
+	int	i;
+
+	line->len = abs(s->x[1] - s->x[0]);
+	if (abs(s->y[1] - s->y[0]) > line->len)
+		line->len = abs(s->y[1] - s->y[0]);
+	line->pos[0] = (long)s->x[0] * 65536 + 0x8000;
+	line->pos[1] = (long)s->y[0] * 65536 + 0x8000;
+	line->inc[0] = 0;
+	line->inc[1] = 0;
+	if (line->len)
+		line->inc[0] = (long)(s->x[1] - s->x[0]) * 65536 / line->len;
+	if (line->len)
+		line->inc[1] = (long)(s->y[1] - s->y[0]) * 65536 / line->len;
+	i = -1;
+	while (++i < 3)
+	{
+		shift = 16 - i * 8;
+		line->rgb[i] = (int)(s->color[0] >> shift & 0xFF) << 16 | 0x8000;
+		line->drgb[i] = 0;
+		if (line->len)
+			line->drgb[i] = ((int)(s->color[1] >> shift & 0xFF)
+					- (int)(s->color[0] >> shift & 0xFF)) * 65536 / line->len;
+	}
+}
+
+// This function moves the walk k steps forward
+void	line_step(t_line *l, long k)
+{
+	l->pos[0] += k * l->inc[0];
+	l->pos[1] += k * l->inc[1];
+	l->rgb[0] += k * l->drgb[0];
+	l->rgb[1] += k * l->drgb[1];
+	l->rgb[2] += k * l->drgb[2];
+	l->len -= k;
+}
+
+// This function jumps to the first step of the walk
+// lying on the row, or below it, at once
+void	line_skip(t_line *l, int row)
+{
+	long	k;
+
+	if (l->inc[1] <= 0 || l->pos[1] >> 16 >= row)
+		return ;
+	k = ((long)row * 65536 - l->pos[1] + l->inc[1] - 1) / l->inc[1];
+	if (k > l->len + 1)
+		k = l->len + 1;
+	line_step(l, k);
+}
+
+// This function swaps the ends of the segment
+void	segment_flip(t_segment *s)
+{
+	t_segment	flipped;
+
+	flipped = (t_segment){{s->x[1], s->x[0]}, {s->y[1], s->y[0]},
+	{s->color[1], s->color[0]}};
+	*s = flipped;
+}
+
+// This function draws the rows [row_min, row_max] of the
+// segment with integer steps only, it is always walked
+// downwards from its top so every band crossed by the
+// segment lights the same pixels without seams; once
+// clipped no pixel has to be bounds checked
+void	draw_segment(t_raster *raster, t_segment *s)
+{
+	t_line	l;
+
+	if (!clip_segment(&raster->clip, s))
+		return ;
+	if (s->y[0] > s->y[1])
+		segment_flip(s);
+	line_init(&l, s);
+	line_skip(&l, raster->row_min);
+	if (l.pos[1] >> 16 < raster->row_min)
+		return ;
+	while (l.len >= 0 && l.pos[1] >> 16 <= raster->row_max)
+	{
+		raster->pixels[(l.pos[1] >> 16) * raster->stride + (l.pos[0] >> 16)]
+			= (l.rgb[0] >> 16) << 16 | (l.rgb[1] >> 16) << 8
+			| l.rgb[2] >> 16;
+		line_step(&l, 1);
+	}
+}
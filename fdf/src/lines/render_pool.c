@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_pool.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/27 11:22:54 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/27 11:22:54 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function is the routine of a render thread, it
+// sleeps until a frame is started and then draws its band
+static void	*render_worker(void *arg)
+{
+	t_render	*render;
+	t_band		*band;
+	int			seen;
+	bool		running;
+
+	band = (t_band *)arg;
+	render = &map()->render;
+	seen = 0;
+	while (1)
+	{
+		pthread_mutex_lock(&render->lock);
+		while (render->running && render->generation == seen)
+			pthread_cond_wait(&render->start, &render->lock);
+		seen = render->generation;
+		running = render->running;
+		pthread_mutex_unlock(&render->lock);
+		if (!running)
+			break ;
+		band_draw(band);
+		pthread_mutex_lock(&render->lock);
+		if (--render->pending == 0)
+			pthread_cond_signal(&render->done);
+		pthread_mutex_unlock(&render->lock);
+	}
+	return (NULL);
+}
+
+// This function starts the render threads, the main thread
+// draws the first band and the bands of any thread that
+// could not be created
+void	render_init(void)
+{
+	t_render	*render;
+	int			i;
+
+	render = &map()->render;
+	pthread_mutex_init(&render->lock, NULL);
+	pthread_cond_init(&render->start, NULL);
+	pthread_cond_init(&render->done, NULL);
+	render->running = true;
+	render->workers = 0;
+	i = 0;
+	while (++i < RENDER_THREADS)
+	{
+		if (pthread_create(&render->bands[i].thread, NULL,
+				render_worker, &render->bands[i]))
+			break ;
+		render->workers++;
+	}
+}
+
+// This function draws all the bands of the frame at once
+// and waits for every thread to be done with its own
+void	render_bands(void)
+{
+	t_render	*render;
+	int			i;
+
+	render = &map()->render;
+	pthread_mutex_lock(&render->lock);
+	render->pending = render->workers;
+	render->generation++;
+	pthread_cond_broadcast(&render->start);
+	pthread_mutex_unlock(&render->lock);
+	band_draw(&render->bands[0]);
+	i = render->workers;
+	while (++i < RENDER_THREADS)
+		band_draw(&render->bands[i]);
+	pthread_mutex_lock(&render->lock);
+	while (render->pending)
+		pthread_cond_wait(&render->done, &render->lock);
+	pthread_mutex_unlock(&render->lock);
+}
+
+// This function stops the render threads and frees
+// the bins of the bands and the cut segments
+void	render_destroy(void)
+{
+	t_render	*render;
+	int			i;
+
+	render = &map()->render;
+	if (render->running)
+	{
+		pthread_mutex_lock(&render->lock);
+		render->running = false;
+		pthread_cond_broadcast(&render->start);
+		pthread_mutex_unlock(&render->lock);
+		i = 0;
+		while (++i <= render->workers)
+			pthread_join(render->bands[i].thread, NULL);
+		pthread_mutex_destroy(&render->lock);
+		pthread_cond_destroy(&render->start);
+		pthread_cond_destroy(&render->done);
+	}
+	i = -1;
+	while (++i < RENDER_THREADS)
+	{
+		free(render->bands[i].edges);
+		render->bands[i].edges = NULL;
+	}
+	free(render->cuts);
+	render->cuts = NULL;
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   smooth.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/11/04 15:32:08 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/11/04 15:32:08 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function blends a color into a pixel with a coverage
+// out of 256, red and blue being weighted by one product
+static void	blend(unsigned int *pixel, unsigned int color, unsigned int alpha)
+{
+	unsigned int	rb;
+	unsigned int	g;
+
+	rb = (color & 0xFF00FF) * alpha + (*pixel & 0xFF00FF) * (256 - alpha);
+	g = (color & 0xFF00) * alpha + (*pixel & 0xFF00) * (256 - alpha);
+	*pixel = (rb >> 8 & 0xFF00FF) | (g >> 8 & 0xFF00);
+}
+
+// This function lights the two pixels a step of the walk
+// falls between, along the minor axis, each by how close
+// it is, through a pointer to the row of the first one
+static void	smooth_step(t_raster *r, t_line *l, bool steep)
+{
+	unsigned int	*row;
+	unsigned int	color;
+	unsigned int	cover;
+	long			minor;
+	int				y;
+
+	color = (l->rgb[0] >> 16) << 16 | (l->rgb[1] >> 16) << 8 | l->rgb[2] >> 16;
+	minor = l->pos[!steep] - 0x8000;
+	cover = minor >> 8 & 0xFF;
+	y = l->pos[1] >> 16;
+	if (!steep)
+		y = minor >> 16;
+	row = r->pixels + (long)y * r->stride;
+	if (steep && y >= r->row_min && y <= r->row_max)
+	{
+		blend(row + (minor >> 16), color, 256 - cover);
+		blend(row + (minor >> 16) + 1, color, cover);
+	}
+	if (steep)
+		return ;
+	if (y >= r->row_min && y <= r->row_max)
+		blend(row + (l->pos[0] >> 16), color, 256 - cover);
+	if (y + 1 >= r->row_min && y + 1 <= r->row_max)
+		blend(row + r->stride + (l->pos[0] >> 16), color, cover);
+}
+
+// This function draws the rows [row_min, row_max] of the
+// segment anti-aliased, Wu's way: the walk of the aliased
+// lines is reused and its 16.16 minor coordinate split
+// between two pixels, the segment being clipped a pixel
+// short of the right and bottom edges for the second one
+void	draw_smooth(t_raster *raster, t_segment *s)
+{
+	t_line	l;
+	t_clip	clip;
+	bool	steep;
+
+	clip = raster->clip;
+	clip.max_x--;
+	clip.max_y--;
+	if (!clip_segment(&clip, s))
+		return ;
+	if (s->y[0] > s->y[1])
+		segment_flip(s);
+	steep = abs(s->y[1] - s->y[0]) > abs(s->x[1] - s->x[0]);
+	line_init(&l, s);
+	line_skip(&l, raster->row_min - 1);
+	while (l.len >= 0 && l.pos[1] >> 16 <= raster->row_max + 1)
+	{
+		smooth_step(raster, &l, steep);
+		line_step(&l, 1);
+	}
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   camera.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/11/06 10:41:55 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/11/06 10:41:55 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function builds the transform of the perspective
+// camera: the model is moved to the eye, turned onto its
+// axes and, w being the distance in front of it, x and y
+// are scaled by the focal length and shifted by w times
+// the middle of the window, so dividing by w projects them
+void	camera_transform(t_view *view, t_transform *tf)
+{
+	double	focal;
+	double	row[4][3];
+	int		i;
+
+	focal = map()->win->win_w / 2.0 / tan(view->fov / 2);
+	i = -1;
+	while (++i < 3)
+	{
+		row[3][i] = -view->rot[2][i];
+		row[0][i] = focal * view->rot[0][i] + map()->win->win_w / 2.0
+			* row[3][i];
+		row[1][i] = focal * view->rot[1][i] + map()->win->win_h / 2.0
+			* row[3][i];
+		row[2][i] = 0;
+	}
+	i = -1;
+	while (++i < 12)
+		tf->m[i / 3][i % 3] = row[i / 3][i % 3];
+	i = -1;
+	while (++i < 4)
+		tf->t[i] = -(row[i][0] * view->eye[0] + row[i][1] * view->eye[1]
+				+ row[i][2] * view->eye[2]);
+	tf->perspective = true;
+}
+
+// This function sets the camera to its starting place:
+// tilted by CAMERA_TILT over the map and far enough from
+// its middle to see all of it
+void	camera_reset(t_view *view)
+{
+	t_coor	*coor;
+	double	distance;
+	int		i;
+
+	coor = map()->coor;
+	view->fov = CAMERA_FOV;
+	mat3_rotation('x', CAMERA_TILT, view->rot);
+	distance = sqrt(coor->range_x * coor->range_x
+			+ coor->range_y * coor->range_y) / 2 / tan(view->fov / 2)
+		+ coor->range_z;
+	i = -1;
+	while (++i < 3)
+		view->eye[i] = view->center[i] + distance * view->rot[2][i];
+}
+
+// This function flies the camera: x pixels sideways and y
+// pixels backwards, at the speed the map moves on the
+// screen in the orthographic view
+void	camera_move(double x, double y)
+{
+	t_view	*view;
+	int		i;
+
+	view = &map()->view;
+	i = -1;
+	while (++i < 3)
+		view->eye[i] += (y * view->rot[2][i] - x * view->rot[0][i])
+			/ view->scale;
+}
+
+// This function zooms the camera by narrowing its field
+// of view, within [CAMERA_FOV_MIN, CAMERA_FOV_MAX]
+void	camera_zoom(double sf)
+{
+	t_view	*view;
+
+	view = &map()->view;
+	view->fov = fmin(fmax(view->fov / sf, CAMERA_FOV_MIN), CAMERA_FOV_MAX);
+}
+
+// This function switches between the orthographic view
+// and the perspective camera, each starting from its
+// own first view
+void	toggle_perspective(void)
+{
+	map()->view.perspective = !map()->view.perspective;
+	if (map()->view.perspective)
+		view_reset();
+	else
+		view_init();
+	map()->frame.dirty = true;
+}
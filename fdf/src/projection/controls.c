@@ -12,113 +12,67 @@
 
 #include "fdf.h"
 
-// This function applies the zoom effect
-// based on the projection center
-void	rescale_projection(double sf)
+// This function turns a pair of opposite keys into
+// a direction: 1, -1, or 0 when both or none are held
+static double	key_axis(bool positive, bool negative)
 {
-	t_node	*head;
-	t_node	*save;
-	double	x_center;
-	double	y_center;
-
-	calculate_center(&x_center, &y_center);
-	head = map()->head;
-	while (head)
-	{
-		save = head;
-		while (head)
-		{
-			head->x = (head->x - x_center) * sf + x_center;
-			head->y = (head->y - y_center) * sf + y_center;
-			head = head->east;
-		}
-		save = save->south;
-		head = save;
-	}
-}
-
-// This function controls the zoom in and out
-void	zoom_controls(bool *changed)
-{
-	t_node	*head;
-
-	head = map()->head;
-	if (map()->keys.zoom_in)
-		rescale_projection(ZOOM_IN_RATIO);
-	else if (map()->keys.zoom_out)
-		rescale_projection(ZOOM_OUT_RATIO);
-	else
-		return ;
-	set_new_max_xy();
-	set_new_min_xy();
-	*changed = true;
-}
-
-// This function controls the translation
-void	translation_controls(bool *changed)
-{
-	if (map()->keys.left)
-		apply_mod(TRANSLATION_RATIO, 'x');
-	else if (map()->keys.right)
-		apply_mod(-TRANSLATION_RATIO, 'x');
-	else if (map()->keys.down)
-		apply_mod(TRANSLATION_RATIO, 'y');
-	else if (map()->keys.up)
-		apply_mod(-TRANSLATION_RATIO, 'y');
-	*changed = true;
+	return ((double)positive - (double)negative);
 }
 
-// This function controls the rotations
-void	rotation_controls(bool *changed)
+// This function applies every held key at once, as a single
+// update of the view scaled by the elapsed seconds, and
+// tells whether the view actually moved
+bool	motion_controls(double dt)
 {
-	double	nangle_x;
-	double	nangle_y;
-	double	nangle_z;
+	t_keybinds	*keys;
+	double		angle[3];
+	double		move[2];
+	double		zoom;
 
-	nangle_x = 0;
-	nangle_y = 0;
-	nangle_z = 0;
-	if (map()->keys.d)
-		nangle_z = ROTATION_RATIO;
-	else if (map()->keys.a)
-		nangle_z = -ROTATION_RATIO;
-	else if (map()->keys.w)
-		nangle_x = ROTATION_RATIO;
-	else if (map()->keys.s)
-		nangle_x = -ROTATION_RATIO;
-	else if (map()->keys.q)
-		nangle_y = -ROTATION_RATIO;
-	else if (map()->keys.e)
-		nangle_y = ROTATION_RATIO;
-	else
-		return ;
-	apply_rotation(nangle_x,
-		nangle_y, nangle_z);
-	center_map();
-	*changed = true;
+	keys = &map()->keys;
+	angle[0] = key_axis(keys->w, keys->s) * ROTATION_SPEED * dt;
+	angle[1] = key_axis(keys->e, keys->q) * ROTATION_SPEED * dt;
+	angle[2] = key_axis(keys->d, keys->a) * ROTATION_SPEED * dt;
+	move[0] = key_axis(keys->left, keys->right) * TRANSLATION_SPEED * dt;
+	move[1] = key_axis(keys->down, keys->up) * TRANSLATION_SPEED * dt;
+	zoom = key_axis(keys->zoom_in, keys->zoom_out) * dt;
+	if (angle[0] || angle[1] || angle[2])
+		view_rotate(angle[0], angle[1], angle[2]);
+	if (move[0] || move[1])
+		view_translate(move[0], move[1]);
+	if (zoom)
+		view_zoom(pow(ZOOM_SPEED, zoom));
+	return (angle[0] || angle[1] || angle[2] || move[0] || move[1] || zoom);
 }
 
-// This function handles of other controls
+// This function is the frame scheduler: it runs at most
+// FRAME_RATE times per second, sleeping in between, moves
+// the view by the time elapsed since its last run, resets
+// it once per press of the reset key and only draws a
+// frame when something changed
 int	central_control(void)
 {
-	bool		changed;
+	t_frame		*frame;
+	long long	now;
+	double		dt;
 
-	changed = false;
-	if (map()->keys.d || map()->keys.a
-		|| map()->keys.w || map()->keys.s
-		|| map()->keys.e || map()->keys.q)
-		rotation_controls(&changed);
-	else if (map()->keys.up || map()->keys.down
-		|| map()->keys.right || map()->keys.left)
+	frame = &map()->frame;
+	now = now_us();
+	if (now - frame->last_update < 1000000 / FRAME_RATE)
+	{
+		usleep(1000000 / FRAME_RATE - (now - frame->last_update));
+		return (0);
+	}
+	dt = fmin((now - frame->last_update) / 1000000.0, MAX_FRAME_TIME);
+	frame->last_update = now;
+	if (motion_controls(dt))
+		frame->dirty = true;
+	if (map()->keys.reset)
 	{
-		translation_controls(&changed);
-		calculate_center(&map()->coor->x_center, &map()->coor->y_center);
+		map()->keys.reset = false;
+		reset_projection(&frame->dirty);
 	}
-	else if (map()->keys.zoom_in || map()->keys.zoom_out)
-		zoom_controls(&changed);
-	else if (map()->keys.reset)
-		reset_projection(&changed);
-	if (changed)
+	if (frame->dirty)
 		rebuild_image();
 	return (0);
 }
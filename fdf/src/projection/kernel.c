@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/25 14:12:40 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/25 14:12:40 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function projects the vertices [i, last) one at
+// a time, it is the whole kernel when no SIMD is
+// available and the tail of the vectorized ones
+static void	project_scalar(t_transform *tf, t_grid *g, size_t i, size_t last)
+{
+	float	sx;
+	float	sy;
+
+	while (i < last)
+	{
+		sx = tf->m[0][0] * g->x[i] + tf->m[0][1] * g->y[i]
+			+ tf->m[0][2] * g->z[i] + tf->t[0];
+		sy = tf->m[1][0] * g->x[i] + tf->m[1][1] * g->y[i]
+			+ tf->m[1][2] * g->z[i] + tf->t[1];
+		g->depth[i] = tf->m[2][0] * g->x[i] + tf->m[2][1] * g->y[i]
+			+ tf->m[2][2] * g->z[i] + tf->t[2];
+		g->sx[i] = fminf(fmaxf(sx, -SCREEN_CLAMP), SCREEN_CLAMP);
+		g->sy[i] = fminf(fmaxf(sy, -SCREEN_CLAMP), SCREEN_CLAMP);
+		i++;
+	}
+}
+
+// This function computes the row r of the transform
+// for the vertex i
+static inline float	tf_row(t_transform *tf, int r, t_grid *g, size_t i)
+{
+	return (tf->m[r][0] * g->x[i] + tf->m[r][1] * g->y[i]
+		+ tf->m[r][2] * g->z[i] + tf->t[r]);
+}
+
+// This function projects the vertices [i, last) one at a
+// time in perspective, dividing by w: the depth is 1 / w
+// so it can be interpolated on the screen, and -1 for the
+// vertices behind the near plane, whose edges are cut
+static void	project_perspective(t_transform *tf, t_grid *g, size_t i,
+		size_t last)
+{
+	float	w;
+	float	inv;
+
+	while (i < last)
+	{
+		w = tf_row(tf, 3, g, i);
+		inv = 1.0f / fmaxf(w, CAMERA_NEAR);
+		g->sx[i] = fminf(fmaxf(tf_row(tf, 0, g, i) * inv, -SCREEN_CLAMP),
+				SCREEN_CLAMP);
+		g->sy[i] = fminf(fmaxf(tf_row(tf, 1, g, i) * inv, -SCREEN_CLAMP),
+				SCREEN_CLAMP);
+		g->depth[i] = inv;
+		if (w < CAMERA_NEAR)
+			g->depth[i] = -1;
+		i++;
+	}
+}
+
+#if defined(NO_SIMD) || !defined(__SSE2__)
+
+// Without SIMD everything is left to the scalar kernel
+size_t	project_simd(t_transform *tf, t_grid *g, size_t i, size_t last)
+{
+	(void)tf;
+	(void)g;
+	(void)last;
+	return (i);
+}
+
+#endif
+
+// This function projects the vertices [first, first + count)
+// of the grid into screen pixels and depth, with the
+// widest kernel the build was compiled for, in either view
+void	project_block(t_transform *tf, t_grid *grid,
+		size_t first, size_t count)
+{
+	size_t	i;
+
+	i = project_simd(tf, grid, first, first + count);
+	if (tf->perspective)
+		project_perspective(tf, grid, i, first + count);
+	else
+		project_scalar(tf, grid, i, first + count);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_avx2.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/25 15:02:11 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/25 15:02:11 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+#if defined(__AVX2__) && !defined(NO_SIMD)
+
+// This function computes a row of the transform for
+// 8 vertices, m holding the row broadcast in 4 registers
+static inline __m256	simd_row(__m256 *m, __m256 x, __m256 y, __m256 z)
+{
+	return (_mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+					_mm256_mul_ps(m[0], x), _mm256_mul_ps(m[1], y)),
+				_mm256_mul_ps(m[2], z)), m[3]));
+}
+
+// This function clamps 8 screen coordinates so
+// the conversion to int never overflows
+static inline __m256i	simd_screen(__m256 v)
+{
+	v = _mm256_max_ps(v, _mm256_set1_ps(-SCREEN_CLAMP));
+	v = _mm256_min_ps(v, _mm256_set1_ps(SCREEN_CLAMP));
+	return (_mm256_cvttps_epi32(v));
+}
+
+// This function broadcasts each coefficient of the
+// transform in its own register, row by row, w included
+static void	simd_broadcast(t_transform *tf, __m256 *m)
+{
+	int	r;
+
+	r = -1;
+	while (++r < 4)
+	{
+		m[r * 4] = _mm256_set1_ps(tf->m[r][0]);
+		m[r * 4 + 1] = _mm256_set1_ps(tf->m[r][1]);
+		m[r * 4 + 2] = _mm256_set1_ps(tf->m[r][2]);
+		m[r * 4 + 3] = _mm256_set1_ps(tf->t[r]);
+	}
+}
+
+// This function projects 8 vertices at a time in
+// perspective, as the scalar kernel does, x and y being
+// divided by w and the depth set to 1 / w, or to -1
+// behind the near plane
+static size_t	simd_perspective(__m256 *m, t_grid *g, size_t i, size_t last)
+{
+	__m256	p[3];
+	__m256	inv;
+	__m256	front;
+
+	while (i + 8 <= last)
+	{
+		p[0] = _mm256_loadu_ps(g->x + i);
+		p[1] = _mm256_loadu_ps(g->y + i);
+		p[2] = _mm256_loadu_ps(g->z + i);
+		inv = simd_row(m + 12, p[0], p[1], p[2]);
+		front = _mm256_cmp_ps(inv, _mm256_set1_ps(CAMERA_NEAR), _CMP_GE_OQ);
+		inv = _mm256_div_ps(_mm256_set1_ps(1.0f),
+				_mm256_max_ps(inv, _mm256_set1_ps(CAMERA_NEAR)));
+		_mm256_storeu_si256((__m256i *)(g->sx + i), simd_screen(
+				_mm256_mul_ps(simd_row(m, p[0], p[1], p[2]), inv)));
+		_mm256_storeu_si256((__m256i *)(g->sy + i), simd_screen(
+				_mm256_mul_ps(simd_row(m + 4, p[0], p[1], p[2]), inv)));
+		_mm256_storeu_ps(g->depth + i, _mm256_or_ps(_mm256_and_ps(front, inv),
+				_mm256_andnot_ps(front, _mm256_set1_ps(-1.0f))));
+		i += 8;
+	}
+	return (i);
+}
+
+// This function projects the vertices 8 at a time with
+// AVX2 and returns where the scalar tail has to start
+size_t	project_simd(t_transform *tf, t_grid *g, size_t i, size_t last)
+{
+	__m256	m[16];
+	__m256	x;
+	__m256	y;
+	__m256	z;
+
+	simd_broadcast(tf, m);
+	if (tf->perspective)
+		return (simd_perspective(m, g, i, last));
+	while (i + 8 <= last)
+	{
+		x = _mm256_loadu_ps(g->x + i);
+		y = _mm256_loadu_ps(g->y + i);
+		z = _mm256_loadu_ps(g->z + i);
+		_mm256_storeu_si256((__m256i *)(g->sx + i),
+			simd_screen(simd_row(m, x, y, z)));
+		_mm256_storeu_si256((__m256i *)(g->sy + i),
+			simd_screen(simd_row(m + 4, x, y, z)));
+		_mm256_storeu_ps(g->depth + i, simd_row(m + 8, x, y, z));
+		i += 8;
+	}
+	return (i);
+}
+
+#endif
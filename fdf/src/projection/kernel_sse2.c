@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kernel_sse2.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/25 15:31:40 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/25 15:31:40 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+#if !defined(__AVX2__) && defined(__SSE2__) && !defined(NO_SIMD)
+
+// This function computes a row of the transform for
+// 4 vertices, m holding the row broadcast in 4 registers
+static inline __m128	simd_row(__m128 *m, __m128 x, __m128 y, __m128 z)
+{
+	return (_mm_add_ps(_mm_add_ps(_mm_add_ps(
+					_mm_mul_ps(m[0], x), _mm_mul_ps(m[1], y)),
+				_mm_mul_ps(m[2], z)), m[3]));
+}
+
+// This function clamps 4 screen coordinates so
+// the conversion to int never overflows
+static inline __m128i	simd_screen(__m128 v)
+{
+	v = _mm_max_ps(v, _mm_set1_ps(-SCREEN_CLAMP));
+	v = _mm_min_ps(v, _mm_set1_ps(SCREEN_CLAMP));
+	return (_mm_cvttps_epi32(v));
+}
+
+// This function broadcasts each coefficient of the
+// transform in its own register, row by row, w included
+static void	simd_broadcast(t_transform *tf, __m128 *m)
+{
+	int	r;
+
+	r = -1;
+	while (++r < 4)
+	{
+		m[r * 4] = _mm_set1_ps(tf->m[r][0]);
+		m[r * 4 + 1] = _mm_set1_ps(tf->m[r][1]);
+		m[r * 4 + 2] = _mm_set1_ps(tf->m[r][2]);
+		m[r * 4 + 3] = _mm_set1_ps(tf->t[r]);
+	}
+}
+
+// This function projects 4 vertices at a time in
+// perspective, as the scalar kernel does, x and y being
+// divided by w and the depth set to 1 / w, or to -1
+// behind the near plane
+static size_t	simd_perspective(__m128 *m, t_grid *g, size_t i, size_t last)
+{
+	__m128	p[3];
+	__m128	inv;
+	__m128	front;
+
+	while (i + 4 <= last)
+	{
+		p[0] = _mm_loadu_ps(g->x + i);
+		p[1] = _mm_loadu_ps(g->y + i);
+		p[2] = _mm_loadu_ps(g->z + i);
+		inv = simd_row(m + 12, p[0], p[1], p[2]);
+		front = _mm_cmpge_ps(inv, _mm_set1_ps(CAMERA_NEAR));
+		inv = _mm_div_ps(_mm_set1_ps(1.0f),
+				_mm_max_ps(inv, _mm_set1_ps(CAMERA_NEAR)));
+		_mm_storeu_si128((__m128i *)(g->sx + i), simd_screen(
+				_mm_mul_ps(simd_row(m, p[0], p[1], p[2]), inv)));
+		_mm_storeu_si128((__m128i *)(g->sy + i), simd_screen(
+				_mm_mul_ps(simd_row(m + 4, p[0], p[1], p[2]), inv)));
+		_mm_storeu_ps(g->depth + i, _mm_or_ps(_mm_and_ps(front, inv),
+				_mm_andnot_ps(front, _mm_set1_ps(-1.0f))));
+		i += 4;
+	}
+	return (i);
+}
+
+// This function projects the vertices 4 at a time with
+// SSE2 and returns where the scalar tail has to start
+size_t	project_simd(t_transform *tf, t_grid *g, size_t i, size_t last)
+{
+	__m128	m[16];
+	__m128	x;
+	__m128	y;
+	__m128	z;
+
+	simd_broadcast(tf, m);
+	if (tf->perspective)
+		return (simd_perspective(m, g, i, last));
+	while (i + 4 <= last)
+	{
+		x = _mm_loadu_ps(g->x + i);
+		y = _mm_loadu_ps(g->y + i);
+		z = _mm_loadu_ps(g->z + i);
+		_mm_storeu_si128((__m128i *)(g->sx + i),
+			simd_screen(simd_row(m, x, y, z)));
+		_mm_storeu_si128((__m128i *)(g->sy + i),
+			simd_screen(simd_row(m + 4, x, y, z)));
+		_mm_storeu_ps(g->depth + i, simd_row(m + 8, x, y, z));
+		i += 4;
+	}
+	return (i);
+}
+
+#endif
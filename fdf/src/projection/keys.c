@@ -49,11 +49,7 @@ void	handle_wasdeq_keys(int key_code, bool pressed)
 int	handle_keybinds(int key_code, bool pressed)
 {
 	if (key_code == LINUX_ESC_KEYCODE)
-	{
-		free_project();
-		free_nodes();
-		exit(EXIT_SUCCESS);
-	}
+		mouse_destroy_window();
 	else if (key_code == KEY_LEFT || key_code == KEY_RIGHT
 		|| key_code == KEY_DOWN || key_code == KEY_UP)
 		handle_arrow_keys(key_code, pressed);
@@ -67,6 +63,14 @@ int	handle_keybinds(int key_code, bool pressed)
 		map()->keys.zoom_out = pressed;
 	else if (key_code == KEY_RESET)
 		map()->keys.reset = pressed;
+	else if (key_code == KEY_FILL && pressed)
+		toggle_fill();
+	else if (key_code == KEY_SMOOTH && pressed)
+		toggle_smooth();
+	else if (key_code == KEY_HUD && pressed)
+		toggle_hud();
+	else if (key_code == KEY_PERSPECTIVE && pressed)
+		toggle_perspective();
 	return (0);
 }
 
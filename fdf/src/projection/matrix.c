@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   matrix.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/24 09:41:52 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/24 09:41:52 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function multiplies two 3x3 matrices,
+// out = a * b, out can be one of the operands
+void	mat3_mul(double a[3][3], double b[3][3], double out[3][3])
+{
+	double	tmp[3][3];
+	int		i;
+	int		j;
+
+	i = -1;
+	while (++i < 3)
+	{
+		j = -1;
+		while (++j < 3)
+			tmp[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j]
+				+ a[i][2] * b[2][j];
+	}
+	ft_memcpy(out, tmp, sizeof(tmp));
+}
+
+// This function sets the matrix to the identity
+void	mat3_identity(double m[3][3])
+{
+	ft_bzero(m, sizeof(double) * 9);
+	m[0][0] = 1;
+	m[1][1] = 1;
+	m[2][2] = 1;
+}
+
+// This function builds the rotation of the given angle
+// around the x, y or z axis, a and b being the two
+// other axes, the ones mixed by the rotation
+void	mat3_rotation(char axis, double angle, double m[3][3])
+{
+	double	c;
+	double	s;
+	int		a;
+	int		b;
+
+	mat3_identity(m);
+	c = cos(angle);
+	s = sin(angle);
+	a = (axis == 'x');
+	b = 2 - (axis == 'z');
+	if (axis == 'y')
+		s = -s;
+	m[a][a] = c;
+	m[a][b] = -s;
+	m[b][a] = s;
+	m[b][b] = c;
+}
+
+// This function scales a row to length 1
+static void	normalize_row(double row[3])
+{
+	double	len;
+
+	len = sqrt(row[0] * row[0] + row[1] * row[1] + row[2] * row[2]);
+	if (len == 0)
+		return ;
+	row[0] /= len;
+	row[1] /= len;
+	row[2] /= len;
+}
+
+// This function makes the rows of a rotation matrix
+// orthonormal again, so rounding errors of the
+// accumulated rotations never build up
+void	mat3_orthonormalize(double m[3][3])
+{
+	double	dot;
+
+	normalize_row(m[0]);
+	dot = m[1][0] * m[0][0] + m[1][1] * m[0][1] + m[1][2] * m[0][2];
+	m[1][0] -= dot * m[0][0];
+	m[1][1] -= dot * m[0][1];
+	m[1][2] -= dot * m[0][2];
+	normalize_row(m[1]);
+	m[2][0] = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+	m[2][1] = m[0][2] * m[1][0] - m[0][0] * m[1][2];
+	m[2][2] = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+}
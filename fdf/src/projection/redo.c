@@ -16,39 +16,54 @@
 // original and flat version
 void	reset_projection(bool *changed)
 {
-	t_node	*head;
-	t_node	*prev;
-
-	head = map()->head;
-	while (head)
-	{
-		prev = head;
-		while (head)
-		{
-			head->x = head->origin_x;
-			head->y = head->origin_y;
-			head->z = head->origin_z;
-			head = head->east;
-		}
-		prev = prev->south;
-		head = prev;
-	}
-	rebuild_projection();
-	center_map();
+	view_reset();
 	*changed = true;
 }
 
+// This function switches between the wireframe and the
+// filled surface, a map of a single row or column having
+// no surface to fill
+void	toggle_fill(void)
+{
+	if (map()->grid.width < 2 || map()->grid.height < 2)
+		return ;
+	map()->fill = !map()->fill;
+	map()->frame.dirty = true;
+}
+
+// This function switches the wireframe between aliased
+// and anti-aliased lines, the faces of the fill mode
+// being drawn the same either way
+void	toggle_smooth(void)
+{
+	map()->smooth = !map()->smooth;
+	map()->frame.dirty = true;
+}
+
+// This function puts the last frame on the window again,
+// with the overlay if it is shown, it is also called when
+// the window has to be repainted
+int	present_image(void)
+{
+	struct timespec	start;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	mlx_put_image_to_window(map()->win->mlx,
+		map()->win->mlx_win, map()->win->img, 0, 0);
+	if (map()->stats.hud)
+		hud_draw();
+	map()->stats.present_us = elapsed_us(start);
+	return (0);
+}
+
 // This function erases the pixels of the 
 // previous projection and redraws the new
 // coordinates on the image
 void	rebuild_image(void)
 {
-	ft_bzero(map()->win->addr,
-		(map()->win->win_h
-			* map()->win->win_w * sizeof(map()->bpp)));
-	put_pixels_on_img();
-	draw_horizontal_lines();
-	draw_vertical_lines();
-	mlx_put_image_to_window(map()->win->mlx,
-		map()->win->mlx_win, map()->win->img, 0, 0);
+	render_grid();
+	stats_frame();
+	present_image();
+	stats_log();
+	map()->frame.dirty = false;
 }
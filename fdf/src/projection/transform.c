@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   transform.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/24 11:05:33 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/24 11:05:33 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function merges the rotation, the scale and the
+// offsets of the view into the single affine transform
+// taking the model coordinates to the screen, w being 1,
+// or builds the one of the perspective camera
+void	view_transform(t_view *view, t_transform *tf)
+{
+	int	i;
+	int	j;
+
+	if (view->perspective)
+	{
+		camera_transform(view, tf);
+		return ;
+	}
+	i = -1;
+	while (++i < 3)
+	{
+		j = -1;
+		while (++j < 3)
+			tf->m[i][j] = view->rot[i][j] * view->scale;
+		tf->t[i] = -(view->rot[i][0] * view->center[0]
+				+ view->rot[i][1] * view->center[1]
+				+ view->rot[i][2] * view->center[2]) * view->scale;
+	}
+	tf->t[0] += view->offset_x;
+	tf->t[1] += view->offset_y;
+	ft_bzero(tf->m[3], sizeof(tf->m[3]));
+	tf->t[3] = 1;
+	tf->perspective = false;
+}
+
+// This function grows the screen bounding box bb, as
+// min x, min y, max x and max y, with the 8 corners of a
+// box of the model, x0 x1 y0 y1 z0 z1: whatever the box
+// holds is projected inside it
+void	view_bounds(t_transform *tf, double box[6], double bb[4])
+{
+	double	p[2];
+	int		c;
+	int		r;
+
+	c = -1;
+	while (++c < 8)
+	{
+		r = -1;
+		while (++r < 2)
+			p[r] = tf->m[r][0] * box[c & 1] + tf->m[r][1]
+				* box[2 + (c >> 1 & 1)] + tf->m[r][2] * box[4 + (c >> 2)]
+				+ tf->t[r];
+		bb[0] = fmin(bb[0], p[0]);
+		bb[1] = fmin(bb[1], p[1]);
+		bb[2] = fmax(bb[2], p[0]);
+		bb[3] = fmax(bb[3], p[1]);
+	}
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   view.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/24 10:27:15 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/24 10:27:15 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function shifts the view so the bounding box of
+// the projection is in the middle of the screen, that box
+// being found through the quadtree without projecting the
+// grid, the perspective camera being left where it is
+void	view_center(void)
+{
+	t_transform	tf;
+	double		bb[4];
+
+	map()->view.recenter = false;
+	if (map()->view.perspective)
+		return ;
+	view_transform(&map()->view, &tf);
+	lod_bounds(&tf, bb);
+	map()->view.offset_x += (int)((map()->win->win_w - bb[2] - bb[0]) / 2);
+	map()->view.offset_y += (int)((map()->win->win_h - bb[3] - bb[1]) / 2);
+}
+
+// This function sets the view to the original
+// and flat version of the map, centered by the next
+// frame, or the camera to its starting place
+void	view_reset(void)
+{
+	t_view	*view;
+
+	view = &map()->view;
+	mat3_identity(view->rot);
+	view->scale = map()->sf / 1.6;
+	view->center[0] = map()->stream.origin_x + (map()->grid.width - 1) / 2.0;
+	view->center[1] = map()->stream.origin_y + (map()->grid.height - 1) / 2.0;
+	view->center[2] = (map()->coor->max_z + map()->coor->min_z) / 2.0;
+	view->offset_x = map()->win->win_w / 2.0;
+	view->offset_y = map()->win->win_h / 2.0;
+	if (view->perspective)
+		camera_reset(view);
+	view->recenter = true;
+}
+
+// This function accumulates the rotations along the 3
+// possible axes, x, y, and z, into the view matrix,
+// the next frame centering the projection again
+void	view_rotate(double angle_x, double angle_y, double angle_z)
+{
+	double	rotation[3][3];
+	t_view	*view;
+
+	view = &map()->view;
+	mat3_rotation('x', angle_x, rotation);
+	mat3_mul(rotation, view->rot, view->rot);
+	mat3_rotation('y', angle_y, rotation);
+	mat3_mul(rotation, view->rot, view->rot);
+	mat3_rotation('z', angle_z, rotation);
+	mat3_mul(rotation, view->rot, view->rot);
+	mat3_orthonormalize(view->rot);
+	view->recenter = true;
+}
+
+// This function applies the zoom effect
+// based on the projection center
+void	view_zoom(double sf)
+{
+	if (map()->view.perspective)
+		camera_zoom(sf);
+	else
+		map()->view.scale *= sf;
+}
+
+// This function moves the projection on the screen,
+// or the camera through the map
+void	view_translate(double x, double y)
+{
+	if (map()->view.perspective)
+		camera_move(x, y);
+	else
+	{
+		map()->view.offset_x += x;
+		map()->view.offset_y += y;
+	}
+}
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hud.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/11/05 12:20:46 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/11/05 12:20:46 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function puts a line of the overlay on the window,
+// its label followed by value / 10^decimals
+static void	hud_line(int line, char *label, long long value, int decimals)
+{
+	char	text[STATS_LINE];
+
+	ft_strlcpy(text, label, STATS_LINE);
+	append_number(text, value, decimals);
+	mlx_string_put(map()->win->mlx, map()->win->mlx_win, HUD_MARGIN,
+		HUD_MARGIN + line * HUD_LINE, HUD_COLOR, text);
+}
+
+// This function puts the stats of the last frame over the
+// image: the frames per second, the time spent projecting,
+// drawing and presenting it, what it drew and the memory,
+// the present being the one of the frame before
+void	hud_draw(void)
+{
+	t_stats	*s;
+
+	s = &map()->stats;
+	hud_line(0, "fps: ", s->fps10, 1);
+	hud_line(1, "frame (ms): ",
+		s->transform_us + s->raster_us + s->present_us, 3);
+	hud_line(2, "transform (ms): ", s->transform_us, 3);
+	hud_line(3, "raster (ms): ", s->raster_us, 3);
+	hud_line(4, "present (ms): ", s->present_us, 3);
+	hud_line(5, "vertices: ", s->vertices, 0);
+	if (map()->fill)
+		hud_line(6, "faces: ", s->segments, 0);
+	else
+		hud_line(6, "segments: ", s->segments, 0);
+	hud_line(7, "clipped: ", s->clipped, 0);
+	hud_line(8, "memory (KB): ", s->memory / 1024, 0);
+}
+
+// This function shows or hides the overlay, the frame
+// being drawn again to erase it
+void	toggle_hud(void)
+{
+	map()->stats.hud = !map()->stats.hud;
+	map()->frame.dirty = true;
+}
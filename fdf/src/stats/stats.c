@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/11/05 11:14:37 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/11/05 11:14:37 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function writes value / 10^decimals at the end
+// of the text, with its decimals
+void	append_number(char *text, long long value, int decimals)
+{
+	char	digits[24];
+	int		i;
+
+	i = 0;
+	while (i < decimals)
+	{
+		digits[i++] = '0' + value % 10;
+		value /= 10;
+	}
+	if (decimals)
+		digits[i++] = '.';
+	digits[i++] = '0' + value % 10;
+	while (value >= 10)
+	{
+		value /= 10;
+		digits[i++] = '0' + value % 10;
+	}
+	text += ft_strlen(text);
+	while (i)
+		*text++ = digits[--i];
+	*text = '\0';
+}
+
+// This function adds up the bytes the map and its
+// rendering hold: the grid and its projection, the
+// quadtree, the bins of the bands, the depth buffer
+// and the tiles a streamed map has mapped
+static size_t	stats_memory(void)
+{
+	t_matrix	*m;
+	size_t		bytes;
+	int			i;
+
+	m = map();
+	bytes = m->grid.size * (sizeof(float) * 4 + sizeof(unsigned int)
+			+ sizeof(int) * 2);
+	bytes += (size_t)m->lod.tiles_w * m->lod.tiles_h;
+	i = -1;
+	while (++i < m->lod.levels)
+		bytes += sizeof(float) * 2 * lod_level_size(m->lod.tiles_w, i)
+			* lod_level_size(m->lod.tiles_h, i);
+	i = -1;
+	while (++i < RENDER_THREADS)
+		bytes += sizeof(size_t) * m->render.bands[i].capacity;
+	bytes += sizeof(float) * m->raster.stride * m->win->win_h;
+	i = -1;
+	while (m->stream.active && ++i < STREAM_CACHE)
+		if (m->stream.cache[i].data)
+			bytes += tile_bytes(&m->stream.head);
+	return (bytes);
+}
+
+// This function closes the stats of a frame: its time
+// since the last one, the frames per second over about
+// a second, restarted after an idle gap, and the memory
+void	stats_frame(void)
+{
+	t_stats		*s;
+	long long	now;
+
+	s = &map()->stats;
+	now = now_us();
+	s->interval_us = 0;
+	if (s->frames)
+		s->interval_us = now - s->last_frame;
+	if (!s->frames || s->interval_us > 1000000)
+		s->second_start = now;
+	if (!s->frames || s->interval_us > 1000000)
+		s->second_frames = 0;
+	else
+		s->second_frames++;
+	if (now - s->second_start >= 1000000)
+	{
+		s->fps10 = s->second_frames * 10000000LL / (now - s->second_start);
+		s->second_start = now;
+		s->second_frames = 0;
+	}
+	s->last_frame = now;
+	s->memory = stats_memory();
+	s->frames++;
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_log.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/11/05 11:52:19 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/11/05 11:52:19 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function writes a field of the CSV log and the
+// comma after it at the end of the line
+static void	log_field(char *line, long long value, int decimals)
+{
+	append_number(line, value, decimals);
+	ft_strlcat(line, ",", STATS_LINE);
+}
+
+// This function opens the CSV log the stats of every
+// frame are written to, it returns 0 if it can't
+int	stats_open(char *log_name)
+{
+	int	fd;
+
+	fd = open(log_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (ft_putendl_fd("Error: Log can't be opened!", 2), 0);
+	ft_putendl_fd("frame,interval_us,fps,transform_us,raster_us,present_us,"
+		"vertices,segments,clipped,memory_kb", fd);
+	map()->stats.log = fd;
+	return (1);
+}
+
+// This function writes the stats of the last frame as a
+// line of the CSV log, if there is one, at once
+void	stats_log(void)
+{
+	t_stats	*s;
+	char	line[STATS_LINE];
+
+	s = &map()->stats;
+	if (s->log <= 0)
+		return ;
+	line[0] = '\0';
+	log_field(line, s->frames - 1, 0);
+	log_field(line, s->interval_us, 0);
+	log_field(line, s->fps10, 1);
+	log_field(line, s->transform_us, 0);
+	log_field(line, s->raster_us, 0);
+	log_field(line, s->present_us, 0);
+	log_field(line, s->vertices, 0);
+	log_field(line, s->segments, 0);
+	log_field(line, s->clipped, 0);
+	append_number(line, s->memory / 1024, 0);
+	ft_strlcat(line, "\n", STATS_LINE);
+	if (write(s->log, line, ft_strlen(line)) < 0)
+		stats_close();
+}
+
+// This function closes the CSV log, if there is one
+void	stats_close(void)
+{
+	if (map()->stats.log > 0)
+		close(map()->stats.log);
+	map()->stats.log = 0;
+}
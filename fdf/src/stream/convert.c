@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   convert.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/31 10:12:37 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/31 10:12:37 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function copies the tile tx of a band of rows
+// into buf, the heights then the colors, the vertices
+// past the end of the map being left to 0
+static void	tile_pack(t_grid *band, int tx, int tile, float *buf)
+{
+	unsigned int	*color;
+	size_t			i;
+	int				count;
+	int				y;
+
+	color = (unsigned int *)(buf + tile * tile);
+	ft_bzero(buf, sizeof(float) * tile * tile * 2);
+	count = fmin(tile, band->width - tx * tile);
+	y = -1;
+	while (++y < band->height)
+	{
+		i = (size_t)y * band->width + (size_t)tx * tile;
+		ft_memcpy(buf + y * tile, band->z + i, sizeof(float) * count);
+		ft_memcpy(color + y * tile, band->color + i,
+			sizeof(unsigned int) * count);
+	}
+}
+
+// This function writes the tiles of a band of rows
+// one after the other, buf holding one tile at a time
+static int	write_band(int fd, t_tiled *head, t_grid *band, float *buf)
+{
+	ssize_t	bytes;
+	int		tx;
+
+	bytes = tile_bytes(head);
+	tx = -1;
+	while (++tx < head->tiles_w)
+	{
+		tile_pack(band, tx, head->tile, buf);
+		if (write(fd, buf, bytes) != bytes)
+			return (0);
+	}
+	return (1);
+}
+
+// This function grows the height range
+// of the map with a band of rows
+static void	band_bounds(t_tiled *head, t_grid *band)
+{
+	size_t	i;
+	size_t	size;
+
+	i = 0;
+	size = (size_t)band->width * band->height;
+	while (i < size)
+	{
+		if (band->z[i] < head->zmin)
+			head->zmin = band->z[i];
+		if (band->z[i] > head->zmax)
+			head->zmax = band->z[i];
+		i++;
+	}
+}
+
+// This function parses the map a band of tile rows at a time
+// and writes its tiles right away, so only one band is ever
+// in memory, and returns the first error found, if any
+int	convert_bands(t_map_file *file, t_tiled *head, int fd)
+{
+	t_grid	band;
+	float	*buf;
+	int		y;
+	int		status;
+
+	ft_bzero(&band, sizeof(t_grid));
+	buf = (float *)malloc(tile_bytes(head));
+	status = ROW_OK;
+	if (!buf || !grid_alloc(&band, head->width, head->tile))
+		status = TILE_NO_MEMORY;
+	y = 0;
+	while (status == ROW_OK && y < head->height)
+	{
+		band.height = fmin(head->tile, head->height - y);
+		status = parse_rows(&band, file->rows + y, band.height);
+		if (status == ROW_OK)
+			band_bounds(head, &band);
+		if (status == ROW_OK && !write_band(fd, head, &band, buf))
+			status = TILE_BAD_WRITE;
+		y += head->tile;
+	}
+	free(buf);
+	grid_free(&band);
+	return (status);
+}
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   follow.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/31 16:48:09 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/31 16:48:09 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function finds the point of the model drawn in the
+// middle of the screen, on the plane of the rotation center,
+// it returns false if that plane is seen edge on; the
+// perspective camera is followed where it flies instead
+static bool	stream_focus(t_transform *tf, double *x, double *y)
+{
+	double	rx;
+	double	ry;
+	double	det;
+	double	z;
+
+	*x = map()->view.eye[0];
+	*y = map()->view.eye[1];
+	if (map()->view.perspective)
+		return (true);
+	z = map()->view.center[2];
+	rx = map()->win->win_w / 2.0 - tf->t[0] - tf->m[0][2] * z;
+	ry = map()->win->win_h / 2.0 - tf->t[1] - tf->m[1][2] * z;
+	det = (double)tf->m[0][0] * tf->m[1][1]
+		- (double)tf->m[0][1] * tf->m[1][0];
+	if (fabs(det) < 1e-12)
+		return (false);
+	*x = (rx * tf->m[1][1] - tf->m[0][1] * ry) / det;
+	*y = (tf->m[0][0] * ry - tf->m[1][0] * rx) / det;
+	return (true);
+}
+
+// This function moves the window of a streamed map so it
+// stays centered on the middle of the screen, in steps of
+// STREAM_SLACK vertices so it isn't cut again every frame
+void	stream_follow(t_transform *tf)
+{
+	t_stream	*stream;
+	double		x;
+	double		y;
+	int			origin_x;
+	int			origin_y;
+
+	stream = &map()->stream;
+	if (!stream->active || !stream_focus(tf, &x, &y))
+		return ;
+	x = floor((x - map()->grid.width / 2.0) / STREAM_SLACK) * STREAM_SLACK;
+	y = floor((y - map()->grid.height / 2.0) / STREAM_SLACK) * STREAM_SLACK;
+	origin_x = fmax(0, fmin(x, stream->head.width - map()->grid.width));
+	origin_y = fmax(0, fmin(y, stream->head.height - map()->grid.height));
+	if (origin_x == stream->origin_x && origin_y == stream->origin_y)
+		return ;
+	stream->origin_x = origin_x;
+	stream->origin_y = origin_y;
+	stream_fill();
+	lod_build();
+}
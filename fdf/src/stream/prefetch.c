@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prefetch.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/31 14:03:19 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/31 14:03:19 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function maps a tile of the ring and asks the
+// kernel to read it ahead, so it is in memory before the
+// window reaches it without the lock being held through
+// the reads, it returns 0 once the ring is stale
+static int	prefetch_tile(t_stream *stream, int tx, int ty, int request)
+{
+	float	*data;
+	int		fresh;
+
+	pthread_mutex_lock(&stream->lock);
+	fresh = stream->running && stream->request == request;
+	data = NULL;
+	if (fresh && (tx < stream->core.min_x || tx > stream->core.max_x
+			|| ty < stream->core.min_y || ty > stream->core.max_y))
+		data = cache_tile(stream, tx, ty);
+	if (data)
+		madvise(data, tile_bytes(&stream->head), MADV_WILLNEED);
+	pthread_mutex_unlock(&stream->lock);
+	return (fresh);
+}
+
+// This function prefetches the tiles of the ring around
+// the window one at a time, releasing the lock in between,
+// until they are all mapped or a new ring is requested
+static void	prefetch_ring(t_stream *stream, t_clip ring, int request)
+{
+	int	tx;
+	int	ty;
+
+	ty = ring.min_y - 1;
+	while (++ty <= ring.max_y)
+	{
+		tx = ring.min_x - 1;
+		while (++tx <= ring.max_x)
+		{
+			if (!prefetch_tile(stream, tx, ty, request))
+				return ;
+		}
+	}
+}
+
+// This function is the routine of the prefetch thread,
+// it sleeps until the window moves and then maps the
+// tiles around its new position
+static void	*prefetch_routine(void *arg)
+{
+	t_stream	*stream;
+	t_clip		ring;
+	int			seen;
+
+	stream = (t_stream *)arg;
+	seen = 0;
+	pthread_mutex_lock(&stream->lock);
+	while (stream->running)
+	{
+		if (stream->request == seen)
+			pthread_cond_wait(&stream->wake, &stream->lock);
+		else
+		{
+			seen = stream->request;
+			ring = stream->ring;
+			pthread_mutex_unlock(&stream->lock);
+			prefetch_ring(stream, ring, seen);
+			pthread_mutex_lock(&stream->lock);
+		}
+	}
+	pthread_mutex_unlock(&stream->lock);
+	return (NULL);
+}
+
+// This function starts the prefetch thread, without it
+// the tiles are only mapped when the window needs them
+void	prefetch_start(t_stream *stream)
+{
+	stream->running = true;
+	stream->threaded = !pthread_create(&stream->thread, NULL,
+			prefetch_routine, stream);
+}
+
+// This function stops the prefetch thread
+void	prefetch_stop(t_stream *stream)
+{
+	pthread_mutex_lock(&stream->lock);
+	stream->running = false;
+	pthread_cond_broadcast(&stream->wake);
+	pthread_mutex_unlock(&stream->lock);
+	if (stream->threaded)
+		pthread_join(stream->thread, NULL);
+	stream->threaded = false;
+}
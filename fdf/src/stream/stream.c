@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stream.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/31 15:17:52 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/31 15:17:52 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function checks the header of a tiled map
+// matches the size of the file and that its tiles
+// can be mapped one by one
+static int	stream_check(t_stream *stream)
+{
+	struct stat	file_stat;
+	t_tiled		*head;
+	long		page;
+
+	head = &stream->head;
+	page = sysconf(_SC_PAGESIZE);
+	if (ft_strncmp(head->magic, "FDFT", 4) || head->version != STREAM_VERSION
+		|| head->width < 1 || head->height < 1
+		|| head->tile < 1 || head->tile > 4096)
+		return (0);
+	if (head->tiles_w != (head->width - 1) / head->tile + 1
+		|| head->tiles_h != (head->height - 1) / head->tile + 1)
+		return (0);
+	if (page < 1 || STREAM_ALIGN % page || tile_bytes(head) % page
+		|| fstat(stream->fd, &file_stat) == -1)
+		return (0);
+	return ((size_t)file_stat.st_size >= STREAM_ALIGN
+		+ tile_bytes(head) * head->tiles_w * head->tiles_h);
+}
+
+// This function allocates the grid as the window of
+// at most STREAM_VIEW x STREAM_VIEW vertices of the
+// map that is resident, starting in its middle
+static void	stream_window(t_stream *stream)
+{
+	int	width;
+	int	height;
+
+	width = fmin(stream->head.width, STREAM_VIEW);
+	height = fmin(stream->head.height, STREAM_VIEW);
+	if (!grid_alloc(&map()->grid, width, height))
+		malloc_error();
+	stream->origin_x = (stream->head.width - width) / 2;
+	stream->origin_y = (stream->head.height - height) / 2;
+}
+
+// Main function to open a tiled map, only the window
+// around the view being read, the tiles around it
+// being mapped ahead by the prefetch thread and the
+// bounds of its heights kept from its header
+void	stream_open(char *file_name)
+{
+	t_stream	*stream;
+
+	stream = &map()->stream;
+	stream->fd = handle_open(file_name);
+	pthread_mutex_init(&stream->lock, NULL);
+	pthread_cond_init(&stream->wake, NULL);
+	stream->active = true;
+	if (read(stream->fd, &stream->head, sizeof(t_tiled)) != sizeof(t_tiled)
+		|| !stream_check(stream))
+		map_error("Tiled map is invalid!");
+	map()->coor->min_z = stream->head.zmin;
+	map()->coor->max_z = stream->head.zmax;
+	map()->coor->z_known = true;
+	stream_window(stream);
+	stream_fill();
+	prefetch_start(stream);
+	ft_printf("Streaming %s: %dx%d in tiles of %dx%d, window of %dx%d\n",
+		file_name, stream->head.width, stream->head.height,
+		stream->head.tile, stream->head.tile,
+		map()->grid.width, map()->grid.height);
+}
+
+// This function stops the prefetch thread
+// and unmaps the tiles of a tiled map
+void	stream_close(void)
+{
+	t_stream	*stream;
+
+	stream = &map()->stream;
+	if (!stream->active)
+		return ;
+	prefetch_stop(stream);
+	cache_clear(stream);
+	close(stream->fd);
+	pthread_mutex_destroy(&stream->lock);
+	pthread_cond_destroy(&stream->wake);
+	stream->active = false;
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stream_fill.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/31 16:02:44 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/31 16:02:44 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function sets the model coordinates of the
+// window, its vertices keeping those they have in the
+// whole map so the view doesn't jump when it moves
+static void	window_coords(t_grid *grid, int origin_x, int origin_y)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < grid->size)
+	{
+		grid->x[i] = origin_x + (int)(i % grid->width);
+		grid->y[i] = origin_y + (int)(i / grid->width);
+		i++;
+	}
+}
+
+// This function sets the tiles the window covers
+// and the ring of tiles around them to prefetch
+static void	stream_ranges(t_stream *stream, t_grid *grid)
+{
+	t_clip	*core;
+	int		tile;
+
+	core = &stream->core;
+	tile = stream->head.tile;
+	core->min_x = stream->origin_x / tile;
+	core->min_y = stream->origin_y / tile;
+	core->max_x = (stream->origin_x + grid->width - 1) / tile;
+	core->max_y = (stream->origin_y + grid->height - 1) / tile;
+	stream->ring.min_x = fmax(0, core->min_x - STREAM_PREFETCH);
+	stream->ring.min_y = fmax(0, core->min_y - STREAM_PREFETCH);
+	stream->ring.max_x = fmin(stream->head.tiles_w - 1,
+			core->max_x + STREAM_PREFETCH);
+	stream->ring.max_y = fmin(stream->head.tiles_h - 1,
+			core->max_y + STREAM_PREFETCH);
+}
+
+// This function copies the part of the tile (tx, ty)
+// that lies in the window into the grid, row after row
+static void	fill_tile(t_stream *stream, float *data, int tx, int ty)
+{
+	t_grid	*grid;
+	t_clip	r;
+	size_t	src;
+	size_t	i;
+	int		t;
+
+	grid = &map()->grid;
+	t = stream->head.tile;
+	r.min_x = fmax(tx * t, stream->origin_x) - stream->origin_x;
+	r.max_x = fmin((tx + 1) * t, stream->origin_x + grid->width)
+		- stream->origin_x;
+	r.min_y = fmax(ty * t, stream->origin_y) - stream->origin_y - 1;
+	r.max_y = fmin((ty + 1) * t, stream->origin_y + grid->height)
+		- stream->origin_y;
+	while (++r.min_y < r.max_y)
+	{
+		src = (size_t)(stream->origin_y + r.min_y - ty * t) * t
+			+ stream->origin_x + r.min_x - tx * t;
+		i = (size_t)r.min_y * grid->width + r.min_x;
+		ft_memcpy(grid->z + i, data + src, sizeof(float) * (r.max_x - r.min_x));
+		ft_memcpy(grid->color + i, (unsigned int *)data + (size_t)t * t + src,
+			sizeof(unsigned int) * (r.max_x - r.min_x));
+	}
+}
+
+// This function copies every tile the window covers
+// into the grid, it returns 0 if one can't be mapped
+static int	fill_core(t_stream *stream)
+{
+	float	*data;
+	int		tx;
+	int		ty;
+
+	ty = stream->core.min_y - 1;
+	while (++ty <= stream->core.max_y)
+	{
+		tx = stream->core.min_x - 1;
+		while (++tx <= stream->core.max_x)
+		{
+			data = cache_tile(stream, tx, ty);
+			if (!data)
+				return (0);
+			fill_tile(stream, data, tx, ty);
+		}
+	}
+	return (1);
+}
+
+// This function cuts the window starting at the origin
+// out of the tiles, mapping the missing ones, and asks
+// the prefetch thread for the ring around it
+void	stream_fill(void)
+{
+	t_stream	*stream;
+	int			ok;
+
+	stream = &map()->stream;
+	window_coords(&map()->grid, stream->origin_x, stream->origin_y);
+	pthread_mutex_lock(&stream->lock);
+	stream->tick++;
+	stream_ranges(stream, &map()->grid);
+	ok = fill_core(stream);
+	stream->request++;
+	pthread_cond_signal(&stream->wake);
+	pthread_mutex_unlock(&stream->lock);
+	if (!ok)
+		map_error("Tile can't be mapped in memory!");
+}
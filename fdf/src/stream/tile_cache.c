@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tile_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/31 11:25:48 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/31 11:25:48 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function returns the slot of the cache
+// holding the tile (tx, ty), -1 if none does
+static int	cache_find(t_stream *stream, int tx, int ty)
+{
+	int	i;
+
+	i = -1;
+	while (++i < STREAM_CACHE)
+	{
+		if (stream->cache[i].data && stream->cache[i].tx == tx
+			&& stream->cache[i].ty == ty)
+			return (i);
+	}
+	return (-1);
+}
+
+// This function picks the slot a new tile goes to,
+// an empty one or the least recently used one
+static int	cache_victim(t_stream *stream)
+{
+	int	best;
+	int	i;
+
+	best = 0;
+	i = -1;
+	while (++i < STREAM_CACHE)
+	{
+		if (!stream->cache[i].data)
+			return (i);
+		if (stream->cache[i].used < stream->cache[best].used)
+			best = i;
+	}
+	return (best);
+}
+
+// This function maps the tile (tx, ty) into a slot
+// of the cache, unmapping the tile it held if any
+static int	cache_map(t_stream *stream, t_cached *slot, int tx, int ty)
+{
+	size_t	bytes;
+	off_t	offset;
+
+	bytes = tile_bytes(&stream->head);
+	if (slot->data)
+		munmap(slot->data, bytes);
+	offset = STREAM_ALIGN + ((off_t)ty * stream->head.tiles_w + tx) * bytes;
+	slot->data = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, stream->fd, offset);
+	if (slot->data == MAP_FAILED)
+	{
+		slot->data = NULL;
+		return (0);
+	}
+	slot->tx = tx;
+	slot->ty = ty;
+	return (1);
+}
+
+// This function returns the tile (tx, ty) mapped in memory,
+// mapping it in place of the least recently used one if it
+// isn't in the cache, or NULL if it can't be mapped, the
+// lock of the stream has to be held
+float	*cache_tile(t_stream *stream, int tx, int ty)
+{
+	int	i;
+
+	i = cache_find(stream, tx, ty);
+	if (i < 0)
+	{
+		i = cache_victim(stream);
+		if (!cache_map(stream, &stream->cache[i], tx, ty))
+			return (NULL);
+	}
+	stream->cache[i].used = stream->tick;
+	return (stream->cache[i].data);
+}
+
+// This function unmaps every tile of the cache
+void	cache_clear(t_stream *stream)
+{
+	int	i;
+
+	i = -1;
+	while (++i < STREAM_CACHE)
+	{
+		if (stream->cache[i].data)
+			munmap(stream->cache[i].data, tile_bytes(&stream->head));
+		stream->cache[i].data = NULL;
+	}
+}
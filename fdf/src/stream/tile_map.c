@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tile_map.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/31 10:40:02 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/31 10:40:02 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function returns the size of a tile on the disk
+size_t	tile_bytes(t_tiled *head)
+{
+	return ((size_t)head->tile * head->tile
+		* (sizeof(float) + sizeof(unsigned int)));
+}
+
+// This function fills the header of the tiled version
+// of a map of width x height vertices
+static void	tile_header(t_tiled *head, int width, int height)
+{
+	ft_bzero(head, sizeof(t_tiled));
+	ft_memcpy(head->magic, "FDFT", 4);
+	head->version = STREAM_VERSION;
+	head->width = width;
+	head->height = height;
+	head->tile = STREAM_TILE;
+	head->tiles_w = (width - 1) / STREAM_TILE + 1;
+	head->tiles_h = (height - 1) / STREAM_TILE + 1;
+	head->zmin = INFINITY;
+	head->zmax = -INFINITY;
+}
+
+// This function removes the tiled map a conversion
+// failed to write and stops with the reason
+static void	tile_error(int status, char *tiled_name)
+{
+	unlink(tiled_name);
+	if (status == ROW_BAD_WIDTH)
+		map_error("Map rows have different lengths!");
+	else if (status == ROW_BAD_ELEMENT)
+		map_error("Map contains an invalid element!");
+	else if (status == TILE_NO_MEMORY)
+		malloc_error();
+	map_error("Tiled map can't be written!");
+}
+
+// This function displays the size of the
+// tiled map and how long it took to write it
+static void	tile_report(char *tiled_name, t_tiled *head, long long us)
+{
+	ft_printf("Tiled %s: %dx%d, %d tiles of %dx%d in ", tiled_name,
+		head->width, head->height, head->tiles_w * head->tiles_h,
+		head->tile, head->tile);
+	put_ms(us);
+	ft_printf(" ms\n");
+}
+
+// Main function to convert a map to the tiled format: ./fdf
+// --tile map.fdf map.fdft, the map is read sequentially and
+// the header written last, once the height range is known
+int	tile_map(char *file_name, char *tiled_name)
+{
+	t_map_file		file;
+	t_tiled			head;
+	struct timespec	start;
+	int				fd;
+	int				status;
+
+	if (!has_extension(file_name, ".fdf")
+		|| !has_extension(tiled_name, ".fdft"))
+		return (ft_putendl_fd("Error: File extension is invalid!", 2), 1);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	open_map(file_name, &file, MADV_SEQUENTIAL);
+	tile_header(&head, count_elements(file.rows[0]), file.rows_amount);
+	fd = open(tiled_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	status = TILE_BAD_WRITE;
+	if (fd != -1 && lseek(fd, STREAM_ALIGN, SEEK_SET) == STREAM_ALIGN)
+		status = convert_bands(&file, &head, fd);
+	unmap_file(&file);
+	if (status == ROW_OK && pwrite(fd, &head, sizeof(t_tiled), 0)
+		!= sizeof(t_tiled))
+		status = TILE_BAD_WRITE;
+	if (fd == -1 || close(fd) == -1 || status != ROW_OK)
+		tile_error(status, tiled_name);
+	tile_report(tiled_name, &head, elapsed_us(start));
+	return (0);
+}
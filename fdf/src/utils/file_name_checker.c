@@ -12,15 +12,26 @@
 
 #include "fdf.h"
 
+// This function checks whether the file
+// name ends with the given extension
+int	has_extension(char *file_name, char *extension)
+{
+	size_t	len;
+	size_t	ext_len;
+
+	len = ft_strlen(file_name);
+	ext_len = ft_strlen(extension);
+	if (len <= ext_len)
+		return (0);
+	return (!ft_strncmp(file_name + len - ext_len, extension, ext_len + 1));
+}
+
 // This function checks whether the file name 
-// is properly formatted or not
+// is properly formatted or not, a text map,
+// a binary one or a tiled one
 int	file_name_checker(char *file_name)
 {
-	int	len;
-
-	len = ft_strlen(file_name) - 1;
-	if (file_name[len] == 'f' && file_name[len - 1] == 'd'
-		&& file_name[len - 2] == 'f' && file_name[len - 3] == '.')
-		return (1);
-	return (0);
+	return (has_extension(file_name, ".fdf")
+		|| has_extension(file_name, ".fdfb")
+		|| has_extension(file_name, ".fdft"));
 }
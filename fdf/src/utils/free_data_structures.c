@@ -27,57 +27,14 @@ void	free_split(char **array)
 	}
 }
 
-// This function searchs for the last line
-// and saves the reference at head and previous
-void	check_south(t_node	**head, t_node **previous)
+// This function frees the arrays of the grid, of its
+// projection and its level of detail, and closes the
+// tiled map it was streamed from, if any
+void	free_grid(void)
 {
-	*previous = *head;
-	while ((*head)->south)
-	{
-		if ((*head)->south->south)
-			*previous = (*head)->south;
-		*head = (*head)->south;
-	}
-	if ((*head)->east)
-		*previous = *head;
-}
-
-// This function searchs for the last lines node
-// and saves the reference at head and previous
-void	check_east(t_node **head, t_node **previous)
-{
-	while ((*head)->east)
-	{
-		if ((*head)->east->east)
-			*previous = (*head)->east;
-		*head = (*head)->east;
-	}
-	if ((*previous)->south == *head)
-		(*previous)->south = NULL;
-	else if ((*previous)->east == *head)
-		(*previous)->east = NULL;
-}
-
-// This function runs throughout all nodes
-// and free from the last to the first
-void	free_nodes(void)
-{
-	t_node	*head;
-	t_node	*previous;
-
-	head = map()->head;
-	while (head)
-	{
-		if (!head->east && !head->south)
-		{
-			free(head);
-			break ;
-		}
-		check_south(&head, &previous);
-		check_east(&head, &previous);
-		free(head);
-		head = map()->head;
-	}
+	stream_close();
+	grid_free(&map()->grid);
+	lod_free(&map()->lod);
 }
 
 // This function free all the 
@@ -87,6 +44,10 @@ void	free_project(void)
 	t_matrix	*map_ref;
 
 	map_ref = map();
+	stats_close();
+	render_destroy();
+	free(map_ref->raster.depth);
+	map_ref->raster.depth = NULL;
 	if (map_ref->win)
 	{
 		if (map_ref->win->mlx)
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/10/21 12:22:18 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/10/21 12:22:18 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fdf.h"
+
+// This function returns the microseconds
+// elapsed since the given instant
+long long	elapsed_us(struct timespec start)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((now.tv_sec - start.tv_sec) * 1000000LL
+		+ (now.tv_nsec - start.tv_nsec) / 1000);
+}
+
+// This function returns the current time of
+// the monotonic clock in microseconds
+long long	now_us(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec * 1000000LL + now.tv_nsec / 1000);
+}
+
+// This function prints a duration in
+// milliseconds with 3 decimals
+void	put_ms(long long us)
+{
+	ft_printf("%u.", (unsigned int)(us / 1000));
+	if (us % 1000 < 100)
+		ft_printf("0");
+	if (us % 1000 < 10)
+		ft_printf("0");
+	ft_printf("%u", (unsigned int)(us % 1000));
+}
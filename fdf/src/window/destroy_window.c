@@ -18,6 +18,6 @@
 int	mouse_destroy_window(void)
 {
 	free_project();
-	free_nodes();
+	free_grid();
 	exit(EXIT_SUCCESS);
 }
@@ -31,6 +31,14 @@
 
 # define GLOSSINESS			48
 
+# ifndef CAMERA_STEP
+#  define CAMERA_STEP		1.0
+# endif
+
+# ifndef REPROJ_DEPTH_TOLERANCE
+#  define REPROJ_DEPTH_TOLERANCE	0.05
+# endif
+
 # define BAD_EXIT			"Error\n"
 
 # define MAX_RATIO			1.0
@@ -78,6 +86,7 @@ typedef struct s_coll_point3
 	t_color		visible_color;
 	t_vec3		normal;
 	double		scalar;
+	size_t		id;
 }	t_coll_point3;
 
 typedef struct s_camera
@@ -152,9 +161,23 @@ typedef union u_collidable_shape
 	t_object_plane		*pl;
 }	t_collidable_shape;
 
+typedef enum e_pixel_state
+{
+	PX_EMPTY,
+	PX_REUSED,
+	PX_REJECTED
+}	t_pixel_state;
+
+typedef struct s_reproj
+{
+	t_coll_point3	**back;
+	char			**state;
+}	t_reproj;
+
 typedef struct s_prog
 {
 	t_coll_point3	**collisions;
+	t_reproj		reproj;
 	t_cvector		*collidables;
 	t_light			light;
 	t_camera		camera;
@@ -180,6 +203,12 @@ void				do_rays(t_prog *program);
 void				trace(t_prog *program);
 t_color				lighting(t_coll_point3 coll, t_vec3 to_light,
 						t_light light);
+void				retrace_holes(t_prog *program);
+bool				is_reused(t_prog *program, int x, int y);
+bool				init_reproj(t_prog *program);
+void				reproject(t_prog *program);
+void				render_frame(t_prog *program, bool reuse);
+void				free_reproj(t_prog *program);
 
 /* ************************************************************************** */
 /*                                   UTILS                                    */
@@ -12,6 +12,28 @@
 
 #include "../../inc/miniRT.h"
 
+/**
+ * Moves the camera along its own axes.
+ *
+ * @param cam		The camera to move.
+ * @param keycode	The keycode of the pressed arrow key.
+ */
+static void	move_camera(t_camera *cam, int keycode)
+{
+	if (keycode == KEY_ARROW_UP)
+		cam->coords = point3_plus_vec3(cam->coords,
+				scale_vec3(cam->forward, CAMERA_STEP));
+	else if (keycode == KEY_ARROW_DOWN)
+		cam->coords = point3_plus_vec3(cam->coords,
+				scale_vec3(cam->forward, -CAMERA_STEP));
+	else if (keycode == KEY_ARROW_RIGHT)
+		cam->coords = point3_plus_vec3(cam->coords,
+				scale_vec3(cam->right, CAMERA_STEP));
+	else if (keycode == KEY_ARROW_LEFT)
+		cam->coords = point3_plus_vec3(cam->coords,
+				scale_vec3(cam->right, -CAMERA_STEP));
+}
+
 /**
  * Handles key events.
  *
@@ -23,6 +45,12 @@ int	key_hook(int keycode, t_prog *program)
 {
 	if (keycode == KEY_ESC)
 		return (killprogram(0, program));
+	if (keycode == KEY_ARROW_UP || keycode == KEY_ARROW_DOWN
+		|| keycode == KEY_ARROW_RIGHT || keycode == KEY_ARROW_LEFT)
+	{
+		move_camera(&program->camera, keycode);
+		render_frame(program, keycode != KEY_ARROW_DOWN);
+	}
 	return (0);
 }
 
@@ -26,6 +26,7 @@ int	killprogram(int keycode, t_prog *program)
 			program->collidables->destroy(program->collidables);
 		if (program->collisions)
 			free_matrix((void **)program->collisions, WINDOW_H);
+		free_reproj(program);
 		if (program->win.win_ptr)
 			mlx_destroy_window(program->win.mlx_ptr, program->win.win_ptr);
 		if (program->win.mlx_ptr)
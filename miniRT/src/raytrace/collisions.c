@@ -24,7 +24,8 @@ t_coll_point3	get_no_collision(void)
 			(t_point3){0, 0, 0}, (t_color){0, 0, 0, 0},
 			(t_color){0, 0, 0, 0},
 			(t_point3){0, 0, 0},
-			INFINITY
+			INFINITY,
+			0
 		});
 }
 
@@ -67,6 +68,7 @@ bool	valid_collision(double scalar)
 
 /**
  * Performs collision detection for a ray with a list of collidable shapes.
+ * The index of the closest shape is kept in the collision id.
  * 
  * @param ray		The ray to check for collision.
  * @param program	The program containing the list of collidable shapes.
@@ -85,6 +87,7 @@ t_coll_point3	do_collisions(t_ray3 ray, t_prog *program)
 	{
 		collidable = program->collidables->get(program->collidables, i);
 		curr_coll = coll_func_wrapper(ray, collidable);
+		curr_coll.id = i;
 		if (valid_collision(curr_coll.scalar)
 			&& curr_coll.scalar < min_coll.scalar)
 			min_coll = curr_coll;
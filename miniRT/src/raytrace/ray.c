@@ -85,3 +85,29 @@ void	do_rays(t_prog *prog)
 		}
 	}
 }
+
+/**
+ * Traces again every pixel the reprojection could not fill or rejected,
+ 	the reused ones keep the shading from the previous frame.
+ * 
+ * @param prog	The program data.
+ */
+void	retrace_holes(t_prog *prog)
+{
+	int	curr_y;
+	int	curr_x;
+
+	curr_y = -1;
+	while (++curr_y < WINDOW_H)
+	{
+		curr_x = -1;
+		while (++curr_x < WINDOW_W)
+		{
+			if (is_reused(prog, curr_x, curr_y))
+				continue ;
+			prog->collisions[curr_y][curr_x] = do_ray(curr_x, curr_y, prog);
+			if (valid_collision(prog->collisions[curr_y][curr_x].scalar))
+				ambient(&prog->collisions[curr_y][curr_x], prog->ambient_l);
+		}
+	}
+}
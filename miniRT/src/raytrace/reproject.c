@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reproject.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dda-cunh <dda-cunh@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/03 10:12:41 by dda-cunh          #+#    #+#             */
+/*   Updated: 2024/06/03 10:12:41 by dda-cunh         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/miniRT.h"
+
+/**
+ * Projects a world point onto the pixel grid of the camera, doing the
+ 	inverse of the ray generation in do_ray.
+ *
+ * @param cam	The camera the new frame is rendered from.
+ * @param p		The world point to project.
+ * @param px	Where the pixel coordinates are written.
+ * @return		True if the point lands inside the window, false otherwise.
+ */
+static bool	project_point(t_camera *cam, t_point3 p, int px[2])
+{
+	t_vec3	d;
+	double	depth;
+	double	ndc_x;
+	double	ndc_y;
+
+	d = vec3_sub(p, cam->coords);
+	depth = vec3_dot_product(d, cam->forward);
+	if (depth <= EPSILON)
+		return (false);
+	ndc_x = vec3_dot_product(d, cam->right) / (depth * cam->tan_fov
+			* ((double)WINDOW_W / (double)WINDOW_H));
+	ndc_y = vec3_dot_product(d, cam->up) / (depth * cam->tan_fov);
+	px[0] = (int)lround((ndc_x + 1.0) * WINDOW_W / 2.0);
+	px[1] = (int)lround((1.0 - ndc_y) * WINDOW_H / 2.0);
+	return (px[0] >= 0 && px[0] < WINDOW_W && px[1] >= 0 && px[1] < WINDOW_H);
+}
+
+/**
+ * Moves a hit of the previous frame into the back grid, keeping the
+ 	closest one when several hits land on the same pixel. Hits whose
+ 	surface now faces away from the camera are dropped.
+ *
+ * @param program	The program data.
+ * @param coll		The hit of the previous frame.
+ */
+static void	splat(t_prog *program, t_coll_point3 coll)
+{
+	t_coll_point3	*dst;
+	int				px[2];
+
+	if (!valid_collision(coll.scalar)
+		|| !project_point(&program->camera, coll.coords, px))
+		return ;
+	if (vec3_dot_product(coll.normal,
+			vec3_from_points(coll.coords, program->camera.coords)) <= 0)
+		return ;
+	coll.scalar = point3_distance_point3(program->camera.coords, coll.coords);
+	dst = &program->reproj.back[px[1]][px[0]];
+	if (program->reproj.state[px[1]][px[0]] != PX_EMPTY
+		&& dst->scalar <= coll.scalar)
+		return ;
+	*dst = coll;
+	program->reproj.state[px[1]][px[0]] = PX_REUSED;
+}
+
+/**
+ * Checks if a reprojected hit shows through a gap of a closer object,
+ 	which happens when a foreground surface gets stretched by the move.
+ *
+ * @param program	The program data.
+ * @param x			The x-coordinate of the pixel.
+ * @param y			The y-coordinate of the pixel.
+ * @return			True if a neighbour belongs to another, closer object.
+ */
+static bool	hidden_by_neighbour(t_prog *program, int x, int y)
+{
+	static const int	offsets[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+	t_coll_point3		*self;
+	t_coll_point3		*other;
+	int					n[2];
+	int					i;
+
+	self = &program->reproj.back[y][x];
+	i = -1;
+	while (++i < 4)
+	{
+		n[0] = x + offsets[i][0];
+		n[1] = y + offsets[i][1];
+		if (n[0] < 0 || n[0] >= WINDOW_W || n[1] < 0 || n[1] >= WINDOW_H
+			|| program->reproj.state[n[1]][n[0]] == PX_EMPTY)
+			continue ;
+		other = &program->reproj.back[n[1]][n[0]];
+		if (other->id != self->id && other->scalar
+			< self->scalar * (1.0 - REPROJ_DEPTH_TOLERANCE))
+			return (true);
+	}
+	return (false);
+}
+
+/**
+ * Rejects the reprojected hits a closer neighbour shows to be seen
+ 	through a gap, leaving them to be traced again.
+ *
+ * @param program	The program data.
+ */
+static void	reject_hidden(t_prog *program)
+{
+	int	x;
+	int	y;
+
+	y = -1;
+	while (++y < WINDOW_H)
+	{
+		x = -1;
+		while (++x < WINDOW_W)
+			if (program->reproj.state[y][x] == PX_REUSED
+				&& hidden_by_neighbour(program, x, y))
+				program->reproj.state[y][x] = PX_REJECTED;
+	}
+}
+
+/**
+ * Reprojects the hits of the previous frame into the current camera.
+ 	Pixels that received a hit passing the depth/id check keep their
+ 	shading, every other one is left to be traced again.
+ *
+ * @param program	The program data.
+ */
+void	reproject(t_prog *program)
+{
+	t_coll_point3	**front;
+	int				x;
+	int				y;
+
+	if (!program->reproj.back && !init_reproj(program))
+		killprogram(EXIT_MALLOC, program);
+	y = -1;
+	while (++y < WINDOW_H)
+		ft_bzero(program->reproj.state[y], WINDOW_W);
+	while (--y >= 0)
+	{
+		x = -1;
+		while (++x < WINDOW_W)
+			splat(program, program->collisions[y][x]);
+	}
+	reject_hidden(program);
+	front = program->collisions;
+	program->collisions = program->reproj.back;
+	program->reproj.back = front;
+}
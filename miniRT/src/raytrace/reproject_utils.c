@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reproject_utils.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dda-cunh <dda-cunh@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2024/06/03 10:40:12 by dda-cunh          #+#    #+#             */
+/*   Updated: 2024/06/03 10:40:12 by dda-cunh         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/miniRT.h"
+
+/**
+ * Allocates the back collision grid and the per pixel state used by the
+ 	reprojection cache.
+ *
+ * @param program	The program data.
+ * @return			True on success, false if an allocation failed.
+ */
+bool	init_reproj(t_prog *program)
+{
+	int	y;
+
+	program->reproj.back = ft_calloc(WINDOW_H, sizeof(t_coll_point3 *));
+	program->reproj.state = ft_calloc(WINDOW_H, sizeof(char *));
+	if (!program->reproj.back || !program->reproj.state)
+		return (false);
+	y = -1;
+	while (++y < WINDOW_H)
+	{
+		program->reproj.back[y] = ft_calloc(WINDOW_W, sizeof(t_coll_point3));
+		program->reproj.state[y] = ft_calloc(WINDOW_W, sizeof(char));
+		if (!program->reproj.back[y] || !program->reproj.state[y])
+			return (false);
+	}
+	return (true);
+}
+
+/**
+ * Checks if the pixel was filled by the reprojection of the previous frame.
+ *
+ * @param program	The program data.
+ * @param x			The x-coordinate of the pixel.
+ * @param y			The y-coordinate of the pixel.
+ * @return			True if the pixel can keep its cached shading.
+ */
+bool	is_reused(t_prog *program, int x, int y)
+{
+	if (!program->reproj.state)
+		return (false);
+	return (program->reproj.state[y][x] == PX_REUSED);
+}
+
+/**
+ * Renders a new frame after a camera move, only tracing the pixels
+ 	the previous frame can't provide. Without reuse every pixel is
+ 	traced again, a step back revealing objects between the old and
+ 	new eye the previous frame never hit.
+ *
+ * @param program	The program data.
+ * @param reuse		Whether the hits of the previous frame can be kept.
+ */
+void	render_frame(t_prog *program, bool reuse)
+{
+	int	y;
+
+	if (reuse)
+		reproject(program);
+	y = -1;
+	while (!reuse && program->reproj.state && ++y < WINDOW_H)
+		ft_bzero(program->reproj.state[y], WINDOW_W);
+	retrace_holes(program);
+	trace(program);
+}
+
+/**
+ * Frees the memory used by the reprojection cache.
+ *
+ * @param program	The program data.
+ */
+void	free_reproj(t_prog *program)
+{
+	if (program->reproj.back)
+		free_matrix((void **)program->reproj.back, WINDOW_H);
+	if (program->reproj.state)
+		free_matrix((void **)program->reproj.state, WINDOW_H);
+	program->reproj.back = NULL;
+	program->reproj.state = NULL;
+}
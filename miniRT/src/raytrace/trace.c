@@ -89,7 +89,8 @@ static t_color	ray_to_lights(t_coll_point3 origin, t_prog *program)
 
 /**
  * Traces rays and calculates the visible colors for each pixel in
- 	the program's collision grid.
+ 	the program's collision grid. Pixels reused by the reprojection
+ 	already hold their final color.
  *
  * @param program	The program containing the collision grid and other data.
  */
@@ -110,7 +111,8 @@ void	trace(t_prog *program)
 			coll = &program->collisions[curr_y][curr_x];
 			if (valid_collision(coll->scalar))
 			{
-				coll->visible_color = ray_to_lights(*coll, program);
+				if (!is_reused(program, curr_x, curr_y))
+					coll->visible_color = ray_to_lights(*coll, program);
 				set_image_pixel(buffer, curr_x, curr_y, coll->visible_color);
 			}
 			curr_x++;
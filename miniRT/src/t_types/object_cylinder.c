@@ -64,7 +64,8 @@ static t_coll_point3	get_side_coll(t_object_cylinder *self,
 			self->color,
 			(t_color){255, 0, 0, 0},
 		side_normal,
-		t
+		t,
+		0
 	});
 }
 
@@ -41,7 +41,8 @@ static t_coll_point3	collide(t_object_plane *self, t_ray3 ray)
 		self->color,
 		(t_color){255, 0, 0, 0},
 		normal_pointing_camera,
-		scalar});
+		scalar,
+		0});
 }
 
 /**
@@ -43,7 +43,8 @@ static t_coll_point3	collide(t_object_sphere *self, t_ray3 ray)
 			self->color,
 			(t_color){255, 0, 0, 0},
 		normalize_vec3(vec3_from_points(self->center, coll_coords)),
-		scalar
+		scalar,
+		0
 	});
 }
 
@@ -12,49 +12,49 @@
 
 #include "philo.h"
 
-/// @brief This function makes the philosopher grab two forks and
-// eat displaying it in the terminal.
+/// @brief This function makes the philosopher grab two forks, or be
+// seated by the waiter, and eat displaying it in the terminal. It
+// keeps the longest the philosopher waited for its forks.
 /// @param philo 
 void	go_eat(t_philo *philo)
 {
-	if (philo->id % 2 == 0)
-	{
-		if (!eat_even(philo))
-			return ;
-	}
-	else
-	{
-		if (!eat_odd(philo))
-			return ;
-	}
-	printf_msg(philo, EATING);
-	philo->eating = true;
-	pthread_mutex_lock(philo->timestamp_lock);
-	philo->last_meal_timestamp = timestamp();
-	pthread_mutex_unlock(philo->timestamp_lock);
-	uwait(philo->time_to_eat_ms);
-	pthread_mutex_lock(&philo->meals_flag_lock);
-	philo->num_meals++;
-	pthread_mutex_unlock(&philo->meals_flag_lock);
-	pthread_mutex_unlock(philo->right_fork);
-	pthread_mutex_unlock(philo->left_fork);
-	philo->eating = false;
+	size_t	hungry;
+
+	hungry = clock_us();
+	if (philo->waiter)
+		waiter_sit(philo);
+	else if (philo->id % 2 == 0 && !eat_even(philo))
+		return ;
+	else if (philo->id % 2 != 0 && !eat_odd(philo))
+		return ;
+	hungry = clock_us() - hungry;
+	if (hungry > philo->max_wait_us)
+		philo->max_wait_us = hungry;
+	log_msg(philo, EVENT_EATING);
+	atomic_store_explicit(&philo->eating, true, memory_order_release);
+	atomic_store_explicit(&philo->last_meal_timestamp, timestamp(),
+		memory_order_release);
+	philo_wait(philo, philo->time_to_eat_ms * MICROSECONDS_IN_A_MILLISECOND);
+	meal_eaten(philo);
+	forks_put(philo);
+	atomic_store_explicit(&philo->eating, false, memory_order_release);
 }
 
 /// @brief This is the sequence for the philosophers, which the id is even,
 // in this case the philosopher grabs the left fork first, then the right. 
 bool	eat_even(t_philo *philo)
 {
-	pthread_mutex_lock(philo->left_fork);
-	printf_msg(philo, TOOK_FORK);
+	fork_take(philo, philo->left_fork);
+	log_msg(philo, EVENT_FORK);
 	if (philo->philos_amount == 1)
 	{
-		uwait(philo->time_to_die_ms);
-		pthread_mutex_unlock(philo->left_fork);
+		philo_wait(philo,
+			philo->time_to_die_ms * MICROSECONDS_IN_A_MILLISECOND);
+		fork_put(philo, philo->left_fork);
 		return (false);
 	}
-	pthread_mutex_lock(philo->right_fork);
-	printf_msg(philo, TOOK_FORK);
+	fork_take(philo, philo->right_fork);
+	log_msg(philo, EVENT_FORK);
 	return (true);
 }
 
@@ -63,16 +63,17 @@ bool	eat_even(t_philo *philo)
 /// @param philo 
 bool	eat_odd(t_philo *philo)
 {
-	pthread_mutex_lock(philo->right_fork);
-	printf_msg(philo, TOOK_FORK);
+	fork_take(philo, philo->right_fork);
+	log_msg(philo, EVENT_FORK);
 	if (philo->philos_amount == 1)
 	{
-		uwait(philo->time_to_die_ms);
-		pthread_mutex_unlock(philo->right_fork);
+		philo_wait(philo,
+			philo->time_to_die_ms * MICROSECONDS_IN_A_MILLISECOND);
+		fork_put(philo, philo->right_fork);
 		return (false);
 	}
-	pthread_mutex_lock(philo->left_fork);
-	printf_msg(philo, TOOK_FORK);
+	fork_take(philo, philo->left_fork);
+	log_msg(philo, EVENT_FORK);
 	return (true);
 }
 
@@ -81,8 +82,8 @@ bool	eat_odd(t_philo *philo)
 /// @param philo 
 void	go_sleep(t_philo *philo)
 {
-	printf_msg(philo, SLEEPING);
-	uwait(philo->time_to_sleep_ms);
+	log_msg(philo, EVENT_SLEEPING);
+	philo_wait(philo, philo->time_to_sleep_ms * MICROSECONDS_IN_A_MILLISECOND);
 }
 
 /// @brief This function makes the philosophers think
@@ -90,7 +91,7 @@ void	go_sleep(t_philo *philo)
 /// @param philo 
 void	go_think(t_philo *philo)
 {
-	printf_msg(philo, THINKING);
-	usleep(500 + abs_value((long)philo->time_to_eat_ms \
+	log_msg(philo, EVENT_THINKING);
+	philo_wait(philo, 500 + abs_value((long)philo->time_to_eat_ms \
 		- (long)philo->time_to_sleep_ms) * MICROSECONDS_IN_A_MILLISECOND);
 }
@@ -0,0 +1,215 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cache_bench.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/10 16:42:17 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/10 16:42:17 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+#include <linux/perf_event.h>
+#include <stddef.h>
+#include <sys/syscall.h>
+
+#ifndef BENCH_LANES
+# define BENCH_LANES 8
+#endif
+
+#ifndef BENCH_ROUNDS
+# define BENCH_ROUNDS 2000000
+#endif
+
+// The layout t_philo and t_fork had before their hot fields got a
+// cache line of their own, allocated the way they were
+typedef struct s_packed_philo
+{
+	atomic_bool			*anyone_dead;
+	atomic_bool			eating;
+	size_t				id;
+	size_t				start_timestamp;
+	atomic_size_t		last_meal_timestamp;
+	size_t				time_to_die_ms;
+	size_t				time_to_eat_ms;
+	size_t				time_to_sleep_ms;
+	atomic_size_t		num_meals;
+	size_t				philos_amount;
+	void				*left_fork;
+	void				*right_fork;
+	void				*ring;
+	void				*monitor;
+	void				*fiber;
+	pthread_t			thread;
+}				t_packed_philo;
+
+typedef struct s_packed_fork
+{
+	pthread_mutex_t		mutex;
+	bool				taken;
+	void				*waiter;
+}				t_packed_fork;
+
+// Where the fields a philosopher touches on each meal are in a layout
+typedef struct s_layout
+{
+	char				*philos;
+	char				*forks;
+	size_t				philo_size;
+	size_t				fork_size;
+	size_t				last_meal;
+	size_t				num_meals;
+	size_t				eating;
+	size_t				time_to_eat;
+}				t_layout;
+
+typedef struct s_lane
+{
+	atomic_size_t		*last_meal;
+	atomic_size_t		*num_meals;
+	atomic_bool			*eating;
+	size_t				*time_to_eat;
+	pthread_mutex_t		*fork;
+	atomic_size_t		*running;
+	pthread_t			thread;
+}				t_lane;
+
+// This function opens the CPU clock, cache misses and L1 data read
+// misses counters of the calling process and of the threads it
+// creates afterwards; a counter the hardware (a virtual machine,
+// often) does not expose is left at -1
+static void	bench_counters(int *fds)
+{
+	struct perf_event_attr	attr;
+	const unsigned int		types[3] = {PERF_TYPE_SOFTWARE,
+		PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE};
+	const unsigned long		configs[3] = {PERF_COUNT_SW_TASK_CLOCK,
+		PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_CACHE_L1D
+		| PERF_COUNT_HW_CACHE_OP_READ << 8
+		| PERF_COUNT_HW_CACHE_RESULT_MISS << 16};
+	int						i;
+
+	i = -1;
+	while (++i < 3)
+	{
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = types[i];
+		attr.config = configs[i];
+		attr.inherit = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	}
+}
+
+// This function eats BENCH_ROUNDS meals the way go_eat does, each
+// lane with a fork nobody else takes, so any miss is false sharing
+static void	*bench_lane(void *arg)
+{
+	t_lane	*lane;
+	size_t	round;
+
+	lane = (t_lane *)arg;
+	round = 0;
+	while (round < BENCH_ROUNDS)
+	{
+		pthread_mutex_lock(lane->fork);
+		atomic_store_explicit(lane->eating, true, memory_order_release);
+		atomic_store_explicit(lane->last_meal, round + *lane->time_to_eat,
+			memory_order_release);
+		atomic_fetch_add_explicit(lane->num_meals, 1, memory_order_relaxed);
+		atomic_store_explicit(lane->eating, false, memory_order_release);
+		pthread_mutex_unlock(lane->fork);
+		round++;
+	}
+	atomic_fetch_sub(lane->running, 1);
+	return (arg);
+}
+
+// This function points every lane to the fields of its philosopher
+// and its fork in the given layout, then starts it
+static void	bench_start(t_lane *lanes, t_layout *layout, atomic_size_t *running)
+{
+	char	*philo;
+	size_t	i;
+
+	atomic_init(running, BENCH_LANES);
+	i = 0;
+	while (i < BENCH_LANES)
+	{
+		philo = layout->philos + i * layout->philo_size;
+		lanes[i].last_meal = (atomic_size_t *)(philo + layout->last_meal);
+		lanes[i].num_meals = (atomic_size_t *)(philo + layout->num_meals);
+		lanes[i].eating = (atomic_bool *)(philo + layout->eating);
+		lanes[i].time_to_eat = (size_t *)(philo + layout->time_to_eat);
+		*lanes[i].time_to_eat = 200;
+		lanes[i].fork = (pthread_mutex_t *)(layout->forks
+				+ i * layout->fork_size);
+		pthread_mutex_init(lanes[i].fork, NULL);
+		lanes[i].running = running;
+		pthread_create(&lanes[i].thread, NULL, bench_lane, &lanes[i]);
+		i++;
+	}
+}
+
+// This function runs the lanes while the calling thread keeps reading
+// them like the monitor does, and prints the CPU time and the cache
+// misses they took
+static void	bench_run(const char *name, t_layout *layout)
+{
+	t_lane			lanes[BENCH_LANES];
+	atomic_size_t	running;
+	int				fds[3];
+	long long		counts[3];
+	size_t			i;
+
+	bench_counters(fds);
+	bench_start(lanes, layout, &running);
+	i = 0;
+	while (atomic_load(&running))
+	{
+		atomic_load_explicit(lanes[i++ % BENCH_LANES].last_meal,
+			memory_order_acquire);
+		usleep(100 / BENCH_LANES);
+	}
+	i = -1;
+	while (++i < BENCH_LANES)
+		pthread_join(lanes[i].thread, NULL);
+	i = -1;
+	while (++i < 3)
+		if (fds[i] < 0 || read(fds[i], &counts[i], sizeof(long long)) < 0)
+			counts[i] = -1;
+	printf("cache_bench: %s: %.1f ns cpu per meal, cache-misses %lld, "
+		"L1D read misses %lld\n", name, counts[0]
+		/ (double)(BENCH_LANES * BENCH_ROUNDS), counts[1], counts[2]);
+}
+
+int	main(void)
+{
+	t_layout	packed;
+	t_layout	padded;
+
+	packed = (t_layout){malloc(sizeof(t_packed_philo) * BENCH_LANES),
+		malloc(sizeof(t_packed_fork) * BENCH_LANES), sizeof(t_packed_philo),
+		sizeof(t_packed_fork), offsetof(t_packed_philo, last_meal_timestamp),
+		offsetof(t_packed_philo, num_meals), offsetof(t_packed_philo, eating),
+		offsetof(t_packed_philo, time_to_eat_ms)};
+	padded = (t_layout){(char *)create_philos(BENCH_LANES),
+		(char *)create_forks(BENCH_LANES), sizeof(t_philo), sizeof(t_fork),
+		offsetof(t_philo, last_meal_timestamp), offsetof(t_philo, num_meals),
+		offsetof(t_philo, eating), offsetof(t_philo, time_to_eat_ms)};
+	if (!packed.philos || !packed.forks || !padded.philos || !padded.forks)
+		return (1);
+	printf("cache_bench: %d lanes x %d meals, -1 for a counter this "
+		"machine does not expose\n", BENCH_LANES, BENCH_ROUNDS);
+	bench_run("packed", &packed);
+	bench_run("padded", &padded);
+	free(packed.philos);
+	free(packed.forks);
+	free(padded.philos);
+	free(padded.forks);
+	return (0);
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sleep_bench.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/08 11:32:19 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/08 11:32:19 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+#ifndef BENCH_THREADS
+# define BENCH_THREADS 200
+#endif
+
+#ifndef BENCH_ROUNDS
+# define BENCH_ROUNDS 20
+#endif
+
+#ifndef BENCH_SLEEP_MS
+# define BENCH_SLEEP_MS 10
+#endif
+
+typedef struct s_sleeper
+{
+	long		oversleep[BENCH_ROUNDS];
+	pthread_t	thread;
+}				t_sleeper;
+
+// This function returns the time of a clock in microseconds, read
+// here rather than through the clock module so the bench measures
+// any uwait the same way
+static size_t	bench_now(clockid_t clock)
+{
+	struct timespec	now;
+
+	clock_gettime(clock, &now);
+	return (now.tv_sec * 1000000 + now.tv_nsec / 1000);
+}
+
+// This function sleeps BENCH_ROUNDS times through uwait and records
+// how many microseconds each sleep overshot, negative when it woke
+// up early
+static void	*bench_sleeper(void *arg)
+{
+	t_sleeper	*sleeper;
+	size_t		start;
+	size_t		round;
+
+	sleeper = (t_sleeper *)arg;
+	round = 0;
+	while (round < BENCH_ROUNDS)
+	{
+		start = bench_now(CLOCK_MONOTONIC);
+		uwait(BENCH_SLEEP_MS);
+		sleeper->oversleep[round++] = (long)(bench_now(CLOCK_MONOTONIC) - start)
+			- BENCH_SLEEP_MS * 1000;
+	}
+	return (arg);
+}
+
+static int	bench_compare(const void *a, const void *b)
+{
+	return ((*(long *)a > *(long *)b) - (*(long *)a < *(long *)b));
+}
+
+// This function runs threads sleepers at once and prints the
+// distribution of their oversleep and the CPU time they burnt
+static void	bench_run(t_sleeper *sleepers, long *all, size_t threads)
+{
+	size_t	cpu;
+	size_t	n;
+	size_t	i;
+
+	cpu = bench_now(CLOCK_PROCESS_CPUTIME_ID);
+	i = -1;
+	while (++i < threads)
+		pthread_create(&sleepers[i].thread, NULL, bench_sleeper, &sleepers[i]);
+	i = -1;
+	while (++i < threads)
+		pthread_join(sleepers[i].thread, NULL);
+	cpu = bench_now(CLOCK_PROCESS_CPUTIME_ID) - cpu;
+	n = threads * BENCH_ROUNDS;
+	i = -1;
+	while (++i < n)
+		all[i] = sleepers[i / BENCH_ROUNDS].oversleep[i % BENCH_ROUNDS];
+	qsort(all, n, sizeof(long), bench_compare);
+	printf("sleep_bench: %3zu threads x %d uwait(%d): oversleep us min %ld "
+		"p50 %ld p90 %ld p99 %ld max %ld, cpu %.1f ms\n", threads,
+		BENCH_ROUNDS, BENCH_SLEEP_MS, all[0], all[n / 2], all[n * 9 / 10],
+		all[n * 99 / 100], all[n - 1], cpu / 1e3);
+}
+
+int	main(void)
+{
+	t_sleeper	*sleepers;
+	long		*all;
+
+	sleepers = malloc(sizeof(t_sleeper) * BENCH_THREADS);
+	all = malloc(sizeof(long) * BENCH_THREADS * BENCH_ROUNDS);
+	if (!sleepers || !all)
+		return (1);
+	bench_run(sleepers, all, 1);
+	bench_run(sleepers, all, BENCH_THREADS);
+	free(sleepers);
+	free(all);
+	return (0);
+}
@@ -0,0 +1,124 @@
+#!/bin/sh
+# Runs philo over a grid of configurations and prints a CSV line per
+# run: whether a death was expected, the deaths, the death detection
+# latency (the printed death minus the last printed meal of that
+# philosopher plus time_to_die), the meals per second, the variance
+# of the meals across philosophers and the CPU time of the run.
+# Fails on an unexpected death, on a death that did not happen, on a
+# run that does not end well or on a latency above MAX_LATENCY ms.
+# usage: bench/sweep.sh [<philo binary> [flags...]]
+# RUNS repeats each configuration, MEALS is what each must eat.
+
+PHILO=${1:-./philo}
+[ $# -gt 0 ] && shift
+FLAGS="$*"
+RUNS=${RUNS:-1}
+MEALS=${MEALS:-5}
+MAX_LATENCY=${MAX_LATENCY:-10}
+TIMEOUT=120
+OUT=$(mktemp)
+CPU=$(mktemp)
+FAILED=0
+trap 'rm -f "$OUT" "$CPU"' EXIT
+
+# cpu: prints the CPU time, user plus system, the children of this
+# shell used between the two times written to CPU, in seconds. times
+# has to run in this shell: a subshell has no children of its own.
+cpu()
+{
+	awk 'NR % 2 == 0 { split($1, u, "m"); split($2, s, "m")
+		t[NR] = u[1] * 60 + u[2] + s[1] * 60 + s[2] }
+		END { printf "%.2f", t[4] - t[2] }' "$CPU"
+}
+
+# expect <n> <die> <eat> <sleep>: prints "die" when a philosopher
+# cannot survive, "live" when all of them can with 10 ms to spare and
+# "either" in between. A turn of the table takes two meals when the
+# philosophers are even and three when they are odd, and never less
+# than eating and sleeping.
+expect()
+{
+	awk -v n="$1" -v die="$2" -v eat="$3" -v sleep="$4" 'BEGIN {
+		cycle = (n % 2 ? 3 : 2) * eat
+		if (eat + sleep > cycle)
+			cycle = eat + sleep
+		if (n == 1 || die < cycle)
+			print "die"
+		else if (die < cycle + 10)
+			print "either"
+		else
+			print "live" }'
+}
+
+# parse <n> <die>: prints the deaths, the latency of the first one,
+# the duration, the meals per second and the variance of the meals
+# per philosopher of the run in OUT
+parse()
+{
+	awk -v n="$1" -v die="$2" '
+		$3 == "is" && $4 == "eating" { meals[$2]++; last[$2] = $1; total++ }
+		$3 == "died" && !deaths++ { death = $1; id = $2 }
+		NF { end = $1 }
+		END {
+			latency = ""
+			if (deaths)
+				latency = death - (last[id] + die)
+			for (i = 1; i <= n; i++)
+				variance += (meals[i] - total / n) ^ 2
+			rate = 0
+			if (end)
+				rate = total * 1000 / end
+			printf "%d,%s,%d,%.1f,%.3f", deaths, latency, end, rate,
+				variance / n }' "$OUT"
+}
+
+# run <n> <die> <eat> <sleep>: runs a configuration RUNS times
+run()
+{
+	EXPECT=$(expect "$@")
+	I=0
+	while [ $I -lt "$RUNS" ]; do
+		I=$((I + 1))
+		times > "$CPU"
+		timeout $TIMEOUT "$PHILO" $FLAGS "$@" "$MEALS" > "$OUT" 2>&1
+		STATUS=$?
+		times >> "$CPU"
+		STATS=$(parse "$1" "$2")
+		DEATHS=${STATS%%,*}
+		LATENCY=$(printf '%s' "$STATS" | cut -d, -f2)
+		UNEXPECTED=0
+		if [ "$EXPECT" = live ] && [ "$DEATHS" -gt 0 ]; then
+			UNEXPECTED=1
+		elif [ "$EXPECT" = die ] && [ "$DEATHS" -eq 0 ]; then
+			UNEXPECTED=1
+		fi
+		ERROR=""
+		if [ $STATUS -ne 0 ]; then
+			ERROR="exit status $STATUS"
+		elif [ $UNEXPECTED -eq 1 ]; then
+			ERROR="expected $EXPECT, $DEATHS died"
+		elif [ -n "$LATENCY" ] && [ "$LATENCY" -gt "$MAX_LATENCY" ]; then
+			ERROR="death printed $LATENCY ms late"
+		fi
+		if [ -n "$ERROR" ]; then
+			printf 'KO  %s: %s\n' "$*" "$ERROR" >&2
+			FAILED=1
+		fi
+		printf '%s,%s,%s,%s,%s,%s,%s,%s,%s,%s,%s,%s\n' "$PHILO" "$FLAGS" \
+			"$1" "$2" "$3" "$4" "$MEALS" "$I" "$STATUS" "$EXPECT" \
+			"$UNEXPECTED" "$STATS,$(cpu)"
+	done
+}
+
+printf '%s,%s,%s,%s,%s,%s,%s,%s,%s,%s,%s,%s,%s,%s,%s,%s,%s\n' binary flags \
+	philosophers time_to_die time_to_eat time_to_sleep meals run status \
+	expected unexpected deaths latency_ms duration_ms meals_per_s \
+	meal_variance cpu_s
+for N in 1 4 5 199 200; do
+	run $N 800 200 200
+	run $N 610 200 200
+	run $N 410 200 200
+	run $N 310 200 100
+	run $N 120 60 60
+done
+exit $FAILED
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   clock.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/08 11:05:43 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/08 11:05:43 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function returns the time of the monotonic clock in
+// microseconds, which unlike the wall clock never jumps.
+/// @param  
+/// @return 
+size_t	clock_us(void)
+{
+	struct timespec	now;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &now) == -1)
+		clock_error();
+	return (now.tv_sec * MICROSECONDS_IN_A_SECOND
+		+ now.tv_nsec / NANOSECONDS_IN_A_MICROSECOND);
+}
+
+/// @brief This function calculates and returns the timestamp in milliseconds.
+/// @param  
+/// @return 
+size_t	timestamp(void)
+{
+	return (clock_us() / MICROSECONDS_IN_A_MILLISECOND);
+}
+
+/// @brief This function pauses the thread until the deadline, given in
+// microseconds of clock_us: it sleeps until CLOCK_SPIN microseconds
+// before it, then polls the clock, yielding the core in between.
+/// @param deadline 
+void	sleep_until(size_t deadline)
+{
+	struct timespec	wake;
+	size_t			now;
+
+	now = clock_us();
+	while (now + CLOCK_SPIN < deadline)
+	{
+		wake.tv_sec = (deadline - CLOCK_SPIN) / MICROSECONDS_IN_A_SECOND;
+		wake.tv_nsec = (deadline - CLOCK_SPIN) % MICROSECONDS_IN_A_SECOND
+			* NANOSECONDS_IN_A_MICROSECOND;
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL);
+		now = clock_us();
+	}
+	while (now < deadline)
+	{
+		sched_yield();
+		now = clock_us();
+	}
+}
+
+/// @brief This function pauses the philosopher for the given amount of
+// microseconds: its thread sleeps, or its fiber gives its worker up.
+/// @param philo 
+/// @param microseconds 
+void	philo_wait(t_philo *philo, size_t microseconds)
+{
+	if (philo->fiber)
+	{
+		philo->fiber->wake = clock_us() + microseconds;
+		fiber_park(philo->fiber, FIBER_SLEEP);
+	}
+	else
+		sleep_until(clock_us() + microseconds);
+}
+
+/// @brief This function pause the process for the amount of milliseconds
+// given as parameter.
+/// @param milliseconds 
+void	uwait(size_t milliseconds)
+{
+	sleep_until(clock_us() + milliseconds * MICROSECONDS_IN_A_MILLISECOND);
+}
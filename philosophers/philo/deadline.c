@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deadline.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/09 15:12:08 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/09 15:12:08 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function gives every philosopher the deadline of its
+// first meal. All of them are equal, which already is a heap.
+/// @param monitor 
+void	deadline_init(t_monitor *monitor)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < monitor->philos_amount)
+	{
+		monitor->deadlines[i].philo = i;
+		monitor->deadlines[i].time = atomic_load_explicit(
+				&monitor->philos[i].last_meal_timestamp, memory_order_acquire)
+			+ monitor->philos[i].time_to_die_ms;
+		i++;
+	}
+}
+
+/// @brief This function moves the deadline at i down the heap after it
+// was pushed back.
+/// @param monitor 
+/// @param i 
+void	deadline_sift(t_monitor *monitor, size_t i)
+{
+	t_deadline	moved;
+	size_t		child;
+
+	moved = monitor->deadlines[i];
+	child = 2 * i + 1;
+	while (child < monitor->philos_amount)
+	{
+		if (child + 1 < monitor->philos_amount
+			&& monitor->deadlines[child + 1].time
+			< monitor->deadlines[child].time)
+			child++;
+		if (monitor->deadlines[child].time >= moved.time)
+			break ;
+		monitor->deadlines[i] = monitor->deadlines[child];
+		i = child;
+		child = 2 * i + 1;
+	}
+	monitor->deadlines[i] = moved;
+}
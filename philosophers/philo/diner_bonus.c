@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   diner_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/12 11:37:19 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/12 11:37:19 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/// @brief This function prints the given event with its timestamp and
+// the id of the philosopher, holding the print semaphore so that the
+// processes never mix their lines nor their timestamps. After a death
+// the semaphore is kept, so nothing else is printed.
+/// @param diner 
+/// @param event 
+void	diner_log(t_diner *diner, int event)
+{
+	t_record	record;
+
+	sem_wait(diner->print);
+	record.time = timestamp();
+	record.id = diner->id;
+	record.event = event;
+	log_record(&diner->logger, &record);
+	log_flush(&diner->logger);
+	if (event == EVENT_DIED)
+		atomic_store_explicit(&diner->table->stop, true, memory_order_release);
+	else
+		sem_post(diner->print);
+}
+
+/// @brief This function counts a meal of the philosopher and, when it is
+// the last one everybody needed, stops the simulation: the process
+// keeps the print semaphore and ends, and the parent ends the others.
+/// @param diner 
+static void	meal_served(t_diner *diner)
+{
+	size_t	meals;
+
+	meals = atomic_fetch_add_explicit(&diner->seat->num_meals, 1,
+			memory_order_release) + 1;
+	if (diner->num_least_meals < 0
+		|| meals != (size_t)diner->num_least_meals)
+		return ;
+	if (atomic_fetch_add_explicit(&diner->table->satisfied, 1,
+			memory_order_acq_rel) + 1 != diner->philos_amount)
+		return ;
+	sem_wait(diner->print);
+	atomic_store_explicit(&diner->table->stop, true, memory_order_release);
+	exit(0);
+}
+
+/// @brief This function makes the philosopher take two forks from the
+// pool, once there is room for it at the table, and eat.
+/// @param diner 
+static void	diner_eat(t_diner *diner)
+{
+	sem_wait(diner->room);
+	sem_wait(diner->forks);
+	diner_log(diner, EVENT_FORK);
+	sem_wait(diner->forks);
+	diner_log(diner, EVENT_FORK);
+	atomic_store_explicit(&diner->seat->eating, true, memory_order_release);
+	atomic_store_explicit(&diner->seat->last_meal_timestamp, timestamp(),
+		memory_order_release);
+	diner_log(diner, EVENT_EATING);
+	uwait(diner->time_to_eat_ms);
+	meal_served(diner);
+	sem_post(diner->forks);
+	sem_post(diner->forks);
+	sem_post(diner->room);
+	atomic_store_explicit(&diner->seat->eating, false, memory_order_release);
+}
+
+/// @brief This function makes the philosopher sleep, then think for
+// as long as the threads of philo do.
+/// @param diner 
+static void	diner_rest(t_diner *diner)
+{
+	diner_log(diner, EVENT_SLEEPING);
+	uwait(diner->time_to_sleep_ms);
+	diner_log(diner, EVENT_THINKING);
+	sleep_until(clock_us() + 500
+		+ abs_value((long)diner->time_to_eat_ms
+			- (long)diner->time_to_sleep_ms)
+		* MICROSECONDS_IN_A_MILLISECOND);
+}
+
+/// @brief This function is the process of a philosopher: it waits for
+// the parent to start the simulation, starts its watchdog and, with
+// half of the philosophers thinking first, eats, sleeps and thinks
+// until the simulation stops. It never returns.
+/// @param diner 
+void	diner_routine(t_diner *diner)
+{
+	sem_wait(diner->start);
+	diner->seat = &diner->table->seats[diner->id - 1];
+	diner->logger.start_timestamp = diner->table->start_timestamp;
+	if (pthread_create(&diner->watchdog, NULL, &watchdog_routine, diner))
+	{
+		pthread_create_error();
+		exit(1);
+	}
+	if (diner->id % 2 == 0 || (diner->philos_amount % 2 != 0
+			&& diner->id == diner->philos_amount))
+	{
+		diner_log(diner, EVENT_THINKING);
+		uwait(1);
+	}
+	while (!atomic_load_explicit(&diner->table->stop, memory_order_acquire))
+	{
+		diner_eat(diner);
+		diner_rest(diner);
+	}
+	exit(0);
+}
@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   error_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/12 10:41:07 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/12 10:41:07 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/// @brief This function displays an error message explaining
+// that the amount of arguments is wrong, and how to call the program.
+/// @param  
+void	bonus_usage_error(void)
+{
+	write(2, WRONG_PARAM_AMOUNT_ERROR_MESSAGE1,
+		ft_strlen(WRONG_PARAM_AMOUNT_ERROR_MESSAGE1));
+	write(2, BONUS_USAGE_MESSAGE, ft_strlen(BONUS_USAGE_MESSAGE));
+	write(2, WRONG_PARAM_AMOUNT_ERROR_MESSAGE4,
+		ft_strlen(WRONG_PARAM_AMOUNT_ERROR_MESSAGE4));
+	write(2, WRONG_PARAM_AMOUNT_ERROR_MESSAGE5,
+		ft_strlen(WRONG_PARAM_AMOUNT_ERROR_MESSAGE5));
+	write(2, WRONG_PARAM_AMOUNT_ERROR_MESSAGE6,
+		ft_strlen(WRONG_PARAM_AMOUNT_ERROR_MESSAGE6));
+}
+
+/// @brief This function displays an error message explaining
+// that a semaphore could not be opened.
+/// @param  
+void	sem_error(void)
+{
+	write(2, SEM_ERROR_MESSAGE, ft_strlen(SEM_ERROR_MESSAGE));
+}
+
+/// @brief This function displays an error message explaining
+// that the shared memory could not be mapped.
+/// @param  
+void	mmap_error(void)
+{
+	write(2, MMAP_ERROR_MESSAGE, ft_strlen(MMAP_ERROR_MESSAGE));
+}
+
+/// @brief This function displays an error message explaining
+// that a philosopher process could not be forked.
+/// @param  
+void	fork_error(void)
+{
+	write(2, FORK_ERROR_MESSAGE, ft_strlen(FORK_ERROR_MESSAGE));
+}
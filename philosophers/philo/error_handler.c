@@ -36,6 +36,8 @@ void	wrong_param_amount_error(void)
 		ft_strlen(WRONG_PARAM_AMOUNT_ERROR_MESSAGE4));
 	write(2, WRONG_PARAM_AMOUNT_ERROR_MESSAGE5,
 		ft_strlen(WRONG_PARAM_AMOUNT_ERROR_MESSAGE5));
+	write(2, WRONG_PARAM_AMOUNT_ERROR_MESSAGE6,
+		ft_strlen(WRONG_PARAM_AMOUNT_ERROR_MESSAGE6));
 }
 
 /// @brief This function displays an error message
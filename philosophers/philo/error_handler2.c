@@ -39,12 +39,11 @@ void	pthread_join_error(void)
 }
 
 /// @brief This function displays an error message explaining
-// that the gettimeofday function call failed.
+// that the clock_gettime function call failed.
 /// @param  
-void	gettimeofday_error(void)
+void	clock_error(void)
 {
-	write(2, GETTIMEOFDAY_ERROR_MESSAGE,
-		ft_strlen(GETTIMEOFDAY_ERROR_MESSAGE));
+	write(2, CLOCK_ERROR_MESSAGE, ft_strlen(CLOCK_ERROR_MESSAGE));
 }
 
 /// @brief This function displays an error message explaining
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fiber.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/10 11:20:46 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/10 11:20:46 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function is where every fiber starts: makecontext only
+// passes ints, so the fiber comes split in two halves. Once the
+// philosopher is done the fiber switches back for good.
+/// @param high 
+/// @param low 
+void	fiber_entry(unsigned int high, unsigned int low)
+{
+	t_fiber	*fiber;
+
+	fiber = (t_fiber *)(((uintptr_t)high << 16 << 16) | (uintptr_t)low);
+	philo_routine(fiber->philo);
+	fiber_park(fiber, FIBER_DONE);
+}
+
+/// @brief This function runs the fiber on the worker until it switches
+// back; meanwhile its philosopher logs to the ring of the worker.
+/// @param worker 
+/// @param fiber 
+void	fiber_resume(t_worker *worker, t_fiber *fiber)
+{
+	fiber->worker = worker;
+	fiber->philo->ring = worker->ring;
+	fiber->action = FIBER_RUN;
+	swapcontext(&worker->context, &fiber->context);
+}
+
+/// @brief This function switches back to the worker, which files the
+// fiber according to the action: to wake it at its wake time, once
+// its fork, its seat or room in the ring of the worker is free, or
+// never again when it is done.
+/// @param fiber 
+/// @param action 
+void	fiber_park(t_fiber *fiber, int action)
+{
+	fiber->action = action;
+	swapcontext(&fiber->context, &fiber->worker->context);
+}
+
+/// @brief This function takes the fork if it is free, otherwise it
+// switches back to the worker, which parks the fiber on the fork.
+/// @param fiber 
+/// @param fork 
+void	fiber_take(t_fiber *fiber, t_fork *fork)
+{
+	t_sched	*sched;
+
+	sched = fiber->worker->sched;
+	pthread_mutex_lock(&sched->lock);
+	if (!fork->taken)
+	{
+		fork->taken = true;
+		pthread_mutex_unlock(&sched->lock);
+		return ;
+	}
+	pthread_mutex_unlock(&sched->lock);
+	fiber->fork = fork;
+	fiber_park(fiber, FIBER_FORK);
+}
+
+/// @brief This function puts the fork down, or hands it straight to
+// the fiber parked on it, which is ready to run again.
+/// @param fiber 
+/// @param fork 
+void	fiber_put(t_fiber *fiber, t_fork *fork)
+{
+	t_sched	*sched;
+
+	sched = fiber->worker->sched;
+	pthread_mutex_lock(&sched->lock);
+	if (fork->waiter)
+	{
+		run_push(sched, fork->waiter);
+		fork->waiter = NULL;
+	}
+	else
+		fork->taken = false;
+	pthread_mutex_unlock(&sched->lock);
+}
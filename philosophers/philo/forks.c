@@ -12,15 +12,16 @@
 
 #include "philo.h"
 
-/// @brief This function allocates memory for all forks.
+/// @brief This function allocates memory for all forks, aligned on a
+// cache line as their layout expects.
 /// @param num_of_philos 
 /// @return 
-pthread_mutex_t	*create_forks(size_t num_of_philos)
+t_fork	*create_forks(size_t num_of_philos)
 {
-	pthread_mutex_t	*forks;
+	t_fork	*forks;
 
-	forks = (pthread_mutex_t *)malloc(sizeof(pthread_mutex_t) * num_of_philos);
-	if (!forks)
+	if (posix_memalign((void **)&forks, CACHE_LINE,
+			sizeof(t_fork) * num_of_philos))
 		return (NULL);
 	return (forks);
 }
@@ -36,19 +37,58 @@ bool	init_forks(t_program *program, size_t num_of_philos)
 	program->forks = create_forks(num_of_philos);
 	if (!program->forks)
 	{
-		free_project(program, FP_LEVEL_4, &malloc_error);
+		free_project(program, FP_LEVEL_3, &malloc_error);
 		return (false);
 	}
 	while (program->created_forks_mutexes < num_of_philos)
 	{
 		if (pthread_mutex_init(
-				&program->forks[program->created_forks_mutexes],
+				&program->forks[program->created_forks_mutexes].mutex,
 				NULL))
 		{
-			free_project(program, FP_LEVEL_5, &mutex_error);
+			free_project(program, FP_LEVEL_4, &mutex_error);
 			return (false);
 		}
+		program->forks[program->created_forks_mutexes].taken = false;
+		program->forks[program->created_forks_mutexes].waiter = NULL;
 		program->created_forks_mutexes++;
 	}
 	return (true);
 }
+
+/// @brief This function makes the philosopher put down both forks, or
+// get up from the waiter when it seated the philosopher.
+/// @param philo 
+void	forks_put(t_philo *philo)
+{
+	if (philo->waiter)
+		waiter_leave(philo);
+	else
+	{
+		fork_put(philo, philo->right_fork);
+		fork_put(philo, philo->left_fork);
+	}
+}
+
+/// @brief This function makes the philosopher take the fork, waiting
+// for it if the neighbour has it.
+/// @param philo 
+/// @param fork 
+void	fork_take(t_philo *philo, t_fork *fork)
+{
+	if (philo->fiber)
+		fiber_take(philo->fiber, fork);
+	else
+		pthread_mutex_lock(&fork->mutex);
+}
+
+/// @brief This function puts the fork back on the table.
+/// @param philo 
+/// @param fork 
+void	fork_put(t_philo *philo, t_fork *fork)
+{
+	if (philo->fiber)
+		fiber_put(philo->fiber, fork);
+	else
+		pthread_mutex_unlock(&fork->mutex);
+}
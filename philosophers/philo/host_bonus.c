@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   host_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/12 12:08:44 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/12 12:08:44 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/// @brief This function forks a process for each philosopher, returns
+// how many it forked. Each child runs its philosopher and never
+// comes back here.
+/// @param diner 
+/// @return 
+static size_t	diners_fork(t_diner *diner)
+{
+	size_t	i;
+	pid_t	pid;
+
+	i = 0;
+	while (i < diner->philos_amount)
+	{
+		diner->id = i + 1;
+		pid = fork();
+		if (pid == -1)
+			return (i);
+		if (pid == 0)
+			diner_routine(diner);
+		diner->pids[i++] = pid;
+	}
+	return (i);
+}
+
+/// @brief This function sets the start of the simulation and the first
+// meal of every seat to now, then lets all the philosophers start.
+/// @param diner 
+static void	table_set(t_diner *diner)
+{
+	size_t	start;
+	size_t	i;
+
+	start = timestamp();
+	diner->table->start_timestamp = start;
+	i = 0;
+	while (i < diner->philos_amount)
+	{
+		atomic_store(&diner->table->seats[i].last_meal_timestamp, start);
+		atomic_store(&diner->table->seats[i].num_meals, 0);
+		atomic_store(&diner->table->seats[i++].eating, false);
+	}
+	i = 0;
+	while (i++ < diner->philos_amount)
+		sem_post(diner->start);
+}
+
+/// @brief This function kills the forked philosophers but the one that
+// is already gone, then waits for them.
+/// @param diner 
+/// @param forked 
+/// @param gone 
+static void	diners_kill(t_diner *diner, size_t forked, pid_t gone)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < forked)
+	{
+		if (diner->pids[i] != gone)
+			kill(diner->pids[i], SIGKILL);
+		i++;
+	}
+	i = 0;
+	while (i < forked)
+	{
+		if (diner->pids[i] != gone)
+			waitpid(diner->pids[i], NULL, 0);
+		i++;
+	}
+}
+
+/// @brief This function runs the simulation: it forks the philosophers,
+// starts them and, as soon as one of them ends, on a death or on the
+// last meal needed, kills the others. Returns false if a process
+// could not be forked or one of them failed.
+/// @param diner 
+/// @return 
+bool	host_run(t_diner *diner)
+{
+	size_t	forked;
+	pid_t	gone;
+	int		status;
+
+	diner->pids = malloc(sizeof(pid_t) * diner->philos_amount);
+	if (!diner->pids)
+	{
+		malloc_error();
+		return (false);
+	}
+	forked = diners_fork(diner);
+	gone = -1;
+	status = 0;
+	if (forked == diner->philos_amount)
+	{
+		table_set(diner);
+		gone = waitpid(-1, &status, 0);
+	}
+	else
+		fork_error();
+	diners_kill(diner, forked, gone);
+	free(diner->pids);
+	return (forked == diner->philos_amount && WIFEXITED(status)
+		&& !WEXITSTATUS(status));
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_format.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/07 10:31:16 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/07 10:31:16 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function appends a number to the buffer of the logger.
+/// @param logger 
+/// @param number 
+static void	log_number(t_logger *logger, size_t number)
+{
+	char	digits[20];
+	size_t	i;
+
+	digits[0] = '0' + number % 10;
+	number /= 10;
+	i = 1;
+	while (number)
+	{
+		digits[i++] = '0' + number % 10;
+		number /= 10;
+	}
+	while (i)
+		logger->buffer[logger->length++] = digits[--i];
+}
+
+/// @brief This function returns the message of an event.
+/// @param event 
+/// @return 
+static const char	*event_text(int event)
+{
+	if (event == EVENT_FORK)
+		return (TOOK_FORK);
+	if (event == EVENT_EATING)
+		return (EATING);
+	if (event == EVENT_SLEEPING)
+		return (SLEEPING);
+	if (event == EVENT_THINKING)
+		return (THINKING);
+	return (DIED);
+}
+
+/// @brief This function formats a record into the buffer of the logger,
+// writing the buffer first when it is almost full.
+/// @param logger 
+/// @param record 
+void	log_record(t_logger *logger, t_record *record)
+{
+	const char	*text;
+	size_t		length;
+
+	if (logger->length > LOG_BUFFER - LOG_LINE)
+		log_flush(logger);
+	log_number(logger, record->time - logger->start_timestamp);
+	logger->buffer[logger->length++] = ' ';
+	log_number(logger, record->id);
+	logger->buffer[logger->length++] = ' ';
+	text = event_text(record->event);
+	length = ft_strlen(text);
+	memcpy(logger->buffer + logger->length, text, length);
+	logger->length += length;
+	if (record->event == EVENT_DIED)
+		logger->died = true;
+}
+
+/// @brief This function writes the buffer of the logger to the terminal
+// with as few write calls as it takes.
+/// @param logger 
+void	log_flush(t_logger *logger)
+{
+	ssize_t	written;
+	size_t	offset;
+
+	offset = 0;
+	while (offset < logger->length)
+	{
+		written = write(1, logger->buffer + offset, logger->length - offset);
+		if (written <= 0)
+			break ;
+		offset += written;
+	}
+	logger->length = 0;
+}
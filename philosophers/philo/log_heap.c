@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_heap.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/07 10:26:48 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/07 10:26:48 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function tells whether the oldest record of ring a
+// comes before the one of ring b: the older one, or the one of the
+// lower ring on a tie, so the death line of the monitor goes first.
+/// @param logger 
+/// @param a 
+/// @param b 
+/// @return 
+static bool	ring_before(t_logger *logger, size_t a, size_t b)
+{
+	size_t	time_a;
+	size_t	time_b;
+
+	time_a = logger->rings[a].records[atomic_load_explicit(
+			&logger->rings[a].tail, memory_order_relaxed)
+		& logger->rings[a].mask].time;
+	time_b = logger->rings[b].records[atomic_load_explicit(
+			&logger->rings[b].tail, memory_order_relaxed)
+		& logger->rings[b].mask].time;
+	return (time_a < time_b || (time_a == time_b && a < b));
+}
+
+/// @brief This function pushes a ring to the heap of the logger.
+/// @param logger 
+/// @param ring 
+void	heap_push(t_logger *logger, size_t ring)
+{
+	size_t	i;
+
+	i = logger->heap_size++;
+	while (i && ring_before(logger, ring, logger->heap[(i - 1) / 2]))
+	{
+		logger->heap[i] = logger->heap[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+	logger->heap[i] = ring;
+}
+
+/// @brief This function pops from the heap of the logger the ring with
+// the oldest record.
+/// @param logger 
+/// @return 
+size_t	heap_pop(t_logger *logger)
+{
+	size_t	top;
+	size_t	last;
+	size_t	child;
+	size_t	i;
+
+	top = logger->heap[0];
+	last = logger->heap[--logger->heap_size];
+	i = 0;
+	child = 1;
+	while (child < logger->heap_size)
+	{
+		if (child + 1 < logger->heap_size
+			&& ring_before(logger, logger->heap[child + 1],
+				logger->heap[child]))
+			child++;
+		if (!ring_before(logger, logger->heap[child], last))
+			break ;
+		logger->heap[i] = logger->heap[child];
+		i = child;
+		child = 2 * i + 1;
+	}
+	logger->heap[i] = last;
+	return (top);
+}
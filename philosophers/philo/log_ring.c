@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_ring.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/07 10:24:05 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/07 10:24:05 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function empties the rings, each over its own slice of
+// the records.
+/// @param rings 
+/// @param records 
+/// @param amount 
+/// @param size records each ring holds, a power of two
+void	rings_init(t_ring *rings, t_record *records, size_t amount,
+	size_t size)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < amount)
+	{
+		atomic_init(&rings[i].head, 0);
+		atomic_init(&rings[i].tail, 0);
+		atomic_init(&rings[i].busy, false);
+		rings[i].mask = size - 1;
+		rings[i].records = records + i * size;
+		i++;
+	}
+}
+
+/// @brief This function tells whether the ring has no room left until
+// the logger pops a record. Only its producer may call it.
+/// @param ring 
+/// @return 
+bool	ring_full(t_ring *ring)
+{
+	return (atomic_load_explicit(&ring->head, memory_order_relaxed)
+		- atomic_load_explicit(&ring->tail, memory_order_acquire)
+		> ring->mask);
+}
+
+/// @brief This function stamps a record and pushes it to the ring,
+// returns false without waiting when the ring is full.
+/// @param ring 
+/// @param id 
+/// @param event 
+/// @return 
+bool	log_push(t_ring *ring, size_t id, int event)
+{
+	t_record	*record;
+	size_t		head;
+
+	if (ring_full(ring))
+		return (false);
+	head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	atomic_store(&ring->busy, true);
+	record = &ring->records[head & ring->mask];
+	record->time = timestamp();
+	record->id = id;
+	record->event = event;
+	atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+	atomic_store(&ring->busy, false);
+	return (true);
+}
+
+/// @brief This function puts the ring in the heap of the logger when
+// its oldest record is older than the watermark.
+/// @param logger 
+/// @param ring 
+/// @param watermark 
+void	ring_offer(t_logger *logger, size_t ring, size_t watermark)
+{
+	t_ring	*r;
+	size_t	tail;
+
+	r = &logger->rings[ring];
+	tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+	if (tail == atomic_load_explicit(&r->head, memory_order_acquire))
+		return ;
+	if (r->records[tail & r->mask].time < watermark)
+		heap_push(logger, ring);
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   logger.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/07 10:21:37 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/07 10:21:37 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function allocates the rings of the logger, one for
+// the monitor and one per producer, and resets its state.
+/// @param logger 
+/// @param rings_amount 
+/// @param ring_size records each ring holds, a power of two
+/// @return 
+bool	logger_init(t_logger *logger, size_t rings_amount, size_t ring_size)
+{
+	if (posix_memalign((void **)&logger->rings, CACHE_LINE,
+			sizeof(t_ring) * rings_amount))
+		logger->rings = NULL;
+	logger->heap = (size_t *)malloc(sizeof(size_t) * rings_amount);
+	logger->records = (t_record *)malloc(sizeof(t_record)
+			* rings_amount * ring_size);
+	if (!logger->rings || !logger->heap || !logger->records)
+	{
+		free(logger->rings);
+		free(logger->heap);
+		free(logger->records);
+		return (false);
+	}
+	rings_init(logger->rings, logger->records, rings_amount, ring_size);
+	logger->rings_amount = rings_amount;
+	logger->start_timestamp = timestamp();
+	logger->watermark = 0;
+	logger->length = 0;
+	logger->died = false;
+	logger->running = false;
+	atomic_init(&logger->stop, false);
+	return (true);
+}
+
+/// @brief This function stops the logger thread once it has printed
+// every record left, then deallocates the rings.
+/// @param logger 
+void	logger_stop(t_logger *logger)
+{
+	if (logger->running)
+	{
+		atomic_store_explicit(&logger->stop, true, memory_order_release);
+		if (pthread_join(logger->thread, NULL))
+			pthread_join_error();
+	}
+	free(logger->rings);
+	free(logger->heap);
+	free(logger->records);
+}
+
+/// @brief This function returns the time below which every record has
+// been pushed: the current time, unless a ring is stamping a record,
+// in which case the watermark stays where it was.
+/// @param logger 
+/// @return 
+static size_t	log_watermark(t_logger *logger)
+{
+	size_t	now;
+	size_t	i;
+
+	now = timestamp();
+	i = 0;
+	while (i < logger->rings_amount)
+	{
+		if (atomic_load(&logger->rings[i++].busy))
+			return (logger->watermark);
+	}
+	if (now > logger->watermark)
+		logger->watermark = now;
+	return (logger->watermark);
+}
+
+/// @brief This function prints, in timestamp order, every record older
+// than the watermark, stopping at the death line.
+/// @param logger 
+/// @param watermark 
+void	log_pass(t_logger *logger, size_t watermark)
+{
+	t_ring	*ring;
+	size_t	tail;
+	size_t	i;
+
+	logger->heap_size = 0;
+	i = 0;
+	while (i < logger->rings_amount)
+		ring_offer(logger, i++, watermark);
+	while (logger->heap_size && !logger->died)
+	{
+		i = heap_pop(logger);
+		ring = &logger->rings[i];
+		tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+		log_record(logger, &ring->records[tail & ring->mask]);
+		atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+		ring_offer(logger, i, watermark);
+	}
+	log_flush(logger);
+}
+
+/// @brief This function drains the rings until the death line is
+// printed or the program stops, when everything left is printed.
+/// @param log 
+/// @return 
+void	*logger_routine(void *log)
+{
+	t_logger	*logger;
+
+	logger = (t_logger *)log;
+	while (!logger->died)
+	{
+		if (atomic_load_explicit(&logger->stop, memory_order_acquire))
+		{
+			log_pass(logger, SIZE_MAX);
+			break ;
+		}
+		log_pass(logger, log_watermark(logger));
+		usleep(LOG_PERIOD);
+	}
+	return (log);
+}
@@ -17,6 +17,7 @@ int	main(int ac, char **av)
 	t_program	program;
 	t_monitor	monitor;
 
+	av += check_flags(&program, &ac, av);
 	if (ac == 5 || ac == 6)
 	{
 		if (!check_all_params(++av))
@@ -26,7 +27,9 @@ int	main(int ac, char **av)
 		monitor_routine(&monitor);
 		if (!run_program(&program))
 			return (1);
-		free_project(&program, FP_LEVEL_6, NULL);
+		if (program.report)
+			report_waits(&program);
+		free_project(&program, FP_LEVEL_5, NULL);
 	}
 	else
 	{
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/12 12:31:58 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/12 12:31:58 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/// @brief This function fills the diner in from the parameters.
+/// @param diner 
+/// @param ac 
+/// @param av 
+static void	diner_init(t_diner *diner, int ac, char **av)
+{
+	memset(diner, 0, sizeof(t_diner));
+	diner->philos_amount = ft_atoul(*av);
+	diner->time_to_die_ms = ft_atoul(*(av + 1));
+	diner->time_to_eat_ms = ft_atoul(*(av + 2));
+	diner->time_to_sleep_ms = ft_atoul(*(av + 3));
+	diner->num_least_meals = -1;
+	if (ac == 6)
+		diner->num_least_meals = ft_atoul(*(av + 4));
+}
+
+int	main(int ac, char **av)
+{
+	t_diner	diner;
+	bool	served;
+
+	if (ac != 5 && ac != 6)
+	{
+		bonus_usage_error();
+		return (1);
+	}
+	if (!check_all_params(++av))
+		return (1);
+	diner_init(&diner, ac, av);
+	if (diner.num_least_meals == 0)
+		return (0);
+	if (!table_open(&diner))
+		return (1);
+	served = host_run(&diner);
+	table_close(&diner);
+	return (!served);
+}
@@ -27,18 +27,36 @@ void	destroy_mutexes(pthread_mutex_t *mutex, size_t num_of_mutexes)
 	}
 }
 
-/// @brief Destroys all mutexes from monitor.
+/// @brief This function destroys the mutexes of all initialized forks.
+/// @param forks 
+/// @param num_of_forks 
+void	destroy_forks(t_fork *forks, size_t num_of_forks)
+{
+	size_t	i;
+
+	i = 0;
+	while (forks && i < num_of_forks)
+	{
+		if (pthread_mutex_destroy(&forks[i++].mutex))
+			mutex_destroy_error();
+	}
+}
+
+/// @brief Stops the logger of the monitor, printing what is left,
+// and destroys what the monitor had initialized up to level.
 /// @param monitor 
+/// @param level 
 void	destroy_monitor(t_monitor *monitor, size_t level)
 {
-	if (level >= 1)
-		destroy_mutexes(&monitor->dead_flag_lock, 1);
-	if (level >= 2)
-		destroy_mutexes(&monitor->meals_flag_lock, 1);
-	if (level >= 3)
-		destroy_mutexes(&monitor->printf_lock, 1);
-	if (level >= 4)
-		destroy_mutexes(&monitor->timestamp_lock, 1);
+	if (level >= FP_LEVEL_3)
+	{
+		logger_stop(&monitor->logger);
+		free(monitor->deadlines);
+	}
+	if (level >= FP_LEVEL_2 && pthread_cond_destroy(&monitor->wake))
+		mutex_destroy_error();
+	if (level >= FP_LEVEL_1)
+		destroy_mutexes(&monitor->wake_lock, 1);
 }
 
 /// @brief  This function deallocates all the memory previously allocated.
@@ -50,20 +68,17 @@ void	free_project(t_program *program,
 {
 	if (call_back_fn)
 		call_back_fn();
-	if (level == 1)
-		destroy_monitor(program->monitor, 1);
-	else if (level == 2)
-		destroy_monitor(program->monitor, 2);
-	else if (level == 3)
-		destroy_monitor(program->monitor, 3);
-	else if (level == 4)
-		destroy_monitor(program->monitor, 4);
-	if (level >= 5)
+	if (level >= FP_LEVEL_1)
+		destroy_monitor(program->monitor, level);
+	if (level >= FP_LEVEL_4)
 	{
-		destroy_monitor(program->monitor, 4);
-		destroy_mutexes(program->forks, program->created_forks_mutexes);
+		destroy_forks(program->forks, program->created_forks_mutexes);
 		free(program->forks);
 	}
-	if (level >= 6)
+	if (level >= FP_LEVEL_5)
+	{
+		sched_destroy(&program->sched);
+		waiter_destroy(&program->waiter);
 		free(program->philos);
+	}
 }
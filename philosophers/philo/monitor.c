@@ -18,30 +18,32 @@
 /// @return 
 bool	init_monitor(t_program *program, char **av)
 {
-	program->monitor->anyone_dead = false;
-	if (!init_monitor_1(program))
-		return (false);
-	if (!init_monitor_2(program))
-		return (false);
+	atomic_init(&program->monitor->anyone_dead, false);
+	atomic_init(&program->monitor->satisfied, 0);
 	if (*(av + 4))
 		program->monitor->num_least_meals = ft_atoul(*(av + 4));
 	else
 		program->monitor->num_least_meals = -1;
 	program->monitor->philos_amount = program->philos_amount;
+	if (!init_monitor_1(program))
+		return (false);
+	if (!init_monitor_2(program))
+		return (false);
 	return (true);
 }
 
-/// @brief This function is the first part of the init_monitor function.
+/// @brief This function is the first part of the init_monitor function:
+// the wake condition waits on the monotonic clock, like the deadlines.
 /// @param program 
 /// @return 
 bool	init_monitor_1(t_program *program)
 {
-	if (pthread_mutex_init(&program->monitor->dead_flag_lock, NULL))
+	if (pthread_mutex_init(&program->monitor->wake_lock, NULL))
 	{
 		free_project(program, FP_LEVEL_0, &mutex_error);
 		return (false);
 	}
-	if (pthread_mutex_init(&program->monitor->meals_flag_lock, NULL))
+	if (!init_clock_cond(&program->monitor->wake))
 	{
 		free_project(program, FP_LEVEL_1, &mutex_error);
 		return (false);
@@ -49,20 +51,65 @@ bool	init_monitor_1(t_program *program)
 	return (true);
 }
 
+/// @brief This function allocates the logger: a ring per philosopher,
+// or a larger one per worker in fiber mode.
+/// @param program 
+/// @return 
+static bool	init_logger(t_program *program)
+{
+	if (program->fibers)
+		return (logger_init(&program->monitor->logger,
+				program->sched.workers_amount + 1, LOG_FIBER_RING));
+	return (logger_init(&program->monitor->logger,
+			program->philos_amount + 1, LOG_RING));
+}
+
 /// @brief This function is the second part of the init_monitor function.
 /// @param program 
 /// @return 
 bool	init_monitor_2(t_program *program)
 {
-	if (pthread_mutex_init(&program->monitor->printf_lock, NULL))
+	t_monitor	*monitor;
+
+	monitor = program->monitor;
+	monitor->deadlines = (t_deadline *)malloc(sizeof(t_deadline)
+			* program->philos_amount);
+	if (!init_logger(program))
+	{
+		free(monitor->deadlines);
+		free_project(program, FP_LEVEL_2, &malloc_error);
+		return (false);
+	}
+	if (!monitor->deadlines)
 	{
-		free_project(program, FP_LEVEL_2, &mutex_error);
+		free_project(program, FP_LEVEL_3, &malloc_error);
 		return (false);
 	}
-	if (pthread_mutex_init(&program->monitor->timestamp_lock, NULL))
+	if (pthread_create(&monitor->logger.thread, NULL, &logger_routine,
+			&monitor->logger))
 	{
-		free_project(program, FP_LEVEL_3, &mutex_error);
+		free_project(program, FP_LEVEL_3, &pthread_create_error);
 		return (false);
 	}
+	monitor->logger.running = true;
 	return (true);
 }
+
+/// @brief This function initializes a condition whose timed waits are
+// given in CLOCK_MONOTONIC time, returns true if it succeed.
+/// @param cond 
+/// @return 
+bool	init_clock_cond(pthread_cond_t *cond)
+{
+	pthread_condattr_t	attr;
+	bool				failed;
+
+	failed = pthread_condattr_init(&attr);
+	if (!failed)
+	{
+		failed = pthread_condattr_setclock(&attr, CLOCK_MONOTONIC)
+			|| pthread_cond_init(cond, &attr);
+		pthread_condattr_destroy(&attr);
+	}
+	return (!failed);
+}
@@ -12,103 +12,88 @@
 
 #include "philo.h"
 
-/// @brief This function checks if the philosopher still alive
-// and returns false if not or true otherwise.
-/// @param philo 
-/// @return 
-bool	check_if_alive(t_philo *philo)
+/// @brief This function stops the simulation and wakes the monitor up.
+/// @param monitor 
+void	monitor_stop(t_monitor *monitor)
 {
-	pthread_mutex_lock(&philo->meals_flag_lock);
-	pthread_mutex_lock(philo->timestamp_lock);
-	if (timestamp() - philo->last_meal_timestamp
-		>= philo->time_to_die_ms && !philo->eating)
-	{
-		pthread_mutex_unlock(philo->timestamp_lock);
-		pthread_mutex_unlock(&philo->meals_flag_lock);
-		return (false);
-	}
-	pthread_mutex_unlock(philo->timestamp_lock);
-	pthread_mutex_unlock(&philo->meals_flag_lock);
-	return (true);
+	atomic_store_explicit(&monitor->anyone_dead, true, memory_order_release);
+	pthread_mutex_lock(&monitor->wake_lock);
+	pthread_cond_broadcast(&monitor->wake);
+	pthread_mutex_unlock(&monitor->wake_lock);
 }
 
-/// @brief This function checks if any philosopher has died.
-// In case anyone has died it writes a message with the timestamp and
-// id of the philosopher changing the value of anyone_dead to true.
-// Returns false if all philosophers still alive, otherwise true.
-/// @param philos 
-/// @return 
-bool	is_anyone_dead(t_philo *philos)
+/// @brief This function counts a meal of the philosopher and, when it is
+// the last one everybody needed, stops the simulation.
+/// @param philo 
+void	meal_eaten(t_philo *philo)
 {
-	unsigned int	i;
+	t_monitor	*monitor;
+	size_t		meals;
 
-	i = 0;
-	while (i < philos[0].philos_amount)
-	{
-		if (!check_if_alive(&philos[i]))
-		{
-			printf_msg(&philos[i], DIED);
-			pthread_mutex_lock(philos[i].dead_flag_lock);
-			*philos[i].anyone_dead = true;
-			pthread_mutex_unlock(philos[i].dead_flag_lock);
-			return (true);
-		}
-		i++;
-	}
-	return (false);
+	monitor = philo->monitor;
+	meals = atomic_fetch_add_explicit(&philo->num_meals, 1,
+			memory_order_release) + 1;
+	if (monitor->num_least_meals < 0
+		|| meals != (size_t)monitor->num_least_meals)
+		return ;
+	if (atomic_fetch_add_explicit(&monitor->satisfied, 1,
+			memory_order_acq_rel) + 1 == monitor->philos_amount)
+		monitor_stop(monitor);
 }
 
-/// @brief This function checks if the philosopher had 
-// the minimum number of meals in case it was given.
-// Returns true if it had or if it has not set, otherwise false.
-/// @param philo 
+/// @brief This function checks the deadlines that have passed: a
+// philosopher who ate since gets its new deadline, one still eating
+// is checked again in a millisecond, any other has died.
+// Returns false if someone has died, otherwise true.
 /// @param monitor 
 /// @return 
-bool	enough_meals_checker(t_philo *philo, t_monitor *monitor)
+static bool	deadline_check(t_monitor *monitor)
 {
-	pthread_mutex_lock(&philo->meals_flag_lock);
-	if (philo->num_meals >= (size_t)monitor->num_least_meals)
+	t_philo	*philo;
+	size_t	deadline;
+	size_t	now;
+
+	now = timestamp();
+	while (monitor->deadlines[0].time <= now)
 	{
-		pthread_mutex_unlock(&philo->meals_flag_lock);
-		return (true);
+		philo = &monitor->philos[monitor->deadlines[0].philo];
+		deadline = atomic_load_explicit(&philo->last_meal_timestamp,
+				memory_order_acquire) + philo->time_to_die_ms;
+		if (deadline <= monitor->deadlines[0].time
+			&& atomic_load_explicit(&philo->eating, memory_order_acquire))
+			deadline = now + 1;
+		else if (deadline <= monitor->deadlines[0].time)
+		{
+			if (!atomic_exchange(&monitor->anyone_dead, true))
+				log_push(&monitor->logger.rings[0], philo->id, EVENT_DIED);
+			return (false);
+		}
+		monitor->deadlines[0].time = deadline;
+		deadline_sift(monitor, 0);
 	}
-	pthread_mutex_unlock(&philo->meals_flag_lock);
-	return (false);
+	return (true);
 }
 
-/// @brief This function checks whether all philosophers have had the minimum
-// number of meals they should. It returns true if they have and false
-// if they have not.
+/// @brief This function sleeps until the given deadline, in milliseconds,
+// unless the simulation stops first.
 /// @param monitor 
-/// @param philos 
-/// @return 
-bool	is_everybody_satisfied(t_monitor *monitor, t_philo *philos)
+/// @param deadline 
+static void	monitor_wait(t_monitor *monitor, size_t deadline)
 {
-	size_t	i;
-	size_t	statisfied_philos;
+	struct timespec	wake;
 
-	i = 0;
-	statisfied_philos = 0;
-	if (monitor->num_least_meals == -1)
-		return (false);
-	while (i < monitor->philos_amount)
-	{
-		if (enough_meals_checker(&philos[i], monitor))
-			statisfied_philos++;
-		i++;
-	}
-	if (monitor->philos_amount == statisfied_philos)
-	{
-		pthread_mutex_lock(&monitor->dead_flag_lock);
-		monitor->anyone_dead = true;
-		pthread_mutex_unlock(&monitor->dead_flag_lock);
-		return (true);
-	}
-	return (false);
+	wake.tv_sec = deadline / MILLISECONDS_IN_A_SECOND;
+	wake.tv_nsec = deadline % MILLISECONDS_IN_A_SECOND
+		* NANOSECONDS_IN_A_MILLISECOND;
+	pthread_mutex_lock(&monitor->wake_lock);
+	if (!atomic_load_explicit(&monitor->anyone_dead, memory_order_acquire))
+		pthread_cond_timedwait(&monitor->wake, &monitor->wake_lock, &wake);
+	pthread_mutex_unlock(&monitor->wake_lock);
 }
 
 /// @brief This function monitors the philosophers until
-// someone dies or all philosophers are satisfied.
+// someone dies or all philosophers are satisfied, sleeping until
+// the earliest time one of them could die.
 /// @param moni 
 /// @return 
 void	*monitor_routine(void *moni)
@@ -116,8 +101,11 @@ void	*monitor_routine(void *moni)
 	t_monitor	*monitor;
 
 	monitor = (t_monitor *)moni;
-	while (!is_everybody_satisfied(monitor, monitor->philos)
-		&& !is_anyone_dead(monitor->philos))
-		usleep(500);
+	deadline_init(monitor);
+	if (monitor->num_least_meals == 0)
+		monitor_stop(monitor);
+	while (!atomic_load_explicit(&monitor->anyone_dead, memory_order_acquire)
+		&& deadline_check(monitor))
+		monitor_wait(monitor, monitor->deadlines[0].time);
 	return (monitor);
 }
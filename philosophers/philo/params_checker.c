@@ -60,3 +60,42 @@ bool	check_all_params(char **av)
 	}
 	return (true);
 }
+
+/// @brief This function sets the option a flag stands for, returns
+// false if the argument is not one of the flags.
+/// @param program 
+/// @param arg 
+/// @return 
+bool	check_flag(t_program *program, char *arg)
+{
+	if (!ft_strcmp(arg, FIBERS_FLAG))
+		program->fibers = true;
+	else if (!ft_strcmp(arg, WAITER_FLAG))
+		program->use_waiter = true;
+	else if (!ft_strcmp(arg, REPORT_FLAG))
+		program->report = true;
+	else
+		return (false);
+	return (true);
+}
+
+/// @brief This function sets the options of the flags that come before
+// the parameters, removes them from the argument count and returns
+// how many they were.
+/// @param program 
+/// @param ac 
+/// @param av 
+/// @return 
+int	check_flags(t_program *program, int *ac, char **av)
+{
+	int	flags;
+
+	program->fibers = false;
+	program->use_waiter = false;
+	program->report = false;
+	flags = 0;
+	while (flags + 1 < *ac && check_flag(program, av[flags + 1]))
+		flags++;
+	*ac -= flags;
+	return (flags);
+}
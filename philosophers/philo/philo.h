@@ -14,11 +14,16 @@
 # define PHILO_H
 
 # include <pthread.h>
+# include <sched.h>
+# include <stdalign.h>
+# include <stdatomic.h>
 # include <stdbool.h>
+# include <stdint.h>
 # include <stdio.h>
 # include <stdlib.h>
 # include <string.h>
-# include <sys/time.h>
+# include <time.h>
+# include <ucontext.h>
 # include <unistd.h>
 
 // MACROS
@@ -33,15 +38,16 @@
 
 // wrong parameter amount error messages
 # define WRONG_PARAM_AMOUNT_ERROR_MESSAGE1 "Error: Wrong amount of arguments\n"
-# define WRONG_PARAM_AMOUNT_ERROR_MESSAGE2 "usage: <number_of_philosophers> "
-# define WRONG_PARAM_AMOUNT_ERROR_MESSAGE3 "<time_to_die_ms> <time_to_eat_ms>"
-# define WRONG_PARAM_AMOUNT_ERROR_MESSAGE4 "<time_to_sleep_ms> [number_of_"
-# define WRONG_PARAM_AMOUNT_ERROR_MESSAGE5 "times_each_philosopher_must_eat]\n"
+# define WRONG_PARAM_AMOUNT_ERROR_MESSAGE2 "usage: [--fibers] [--waiter] "
+# define WRONG_PARAM_AMOUNT_ERROR_MESSAGE3 "[--report] <number_of_philosophers>"
+# define WRONG_PARAM_AMOUNT_ERROR_MESSAGE4 " <time_to_die_ms> <time_to_eat_ms>"
+# define WRONG_PARAM_AMOUNT_ERROR_MESSAGE5 " <time_to_sleep_ms> [number_of_"
+# define WRONG_PARAM_AMOUNT_ERROR_MESSAGE6 "times_each_philosopher_must_eat]\n"
 // wrong parameter amount error messages
 
-// getimeofday error message
-# define GETTIMEOFDAY_ERROR_MESSAGE "Error: gettimeofday() failed!n"
-// getimeofday error message
+// clock error message
+# define CLOCK_ERROR_MESSAGE "Error: clock_gettime() failed!\n"
+// clock error message
 
 // mutex error message
 # define MUTEX_ERROR_MESSAGE "Error: Mutex failed!\n"
@@ -71,15 +77,27 @@
 # define FP_LEVEL_3 3
 # define FP_LEVEL_4 4
 # define FP_LEVEL_5 5
-# define FP_LEVEL_6 6
 // Free project levels
 
+// cache line
+// bytes the data written by different threads is kept apart by
+# define CACHE_LINE 64
+// cache line
+
 // Time factor
 # define MICROSECONDS_IN_A_SECOND 1000000
 # define MICROSECONDS_IN_A_MILLISECOND 1000
 # define MILLISECONDS_IN_A_SECOND 1000
+# define NANOSECONDS_IN_A_MICROSECOND 1000
+# define NANOSECONDS_IN_A_MILLISECOND 1000000
 // Time factor
 
+// clock
+// microseconds before a deadline where the sleeper stops sleeping
+// and polls the clock instead
+# define CLOCK_SPIN 200
+// clock
+
 // philo actions
 # define SLEEPING "is sleeping\n"
 # define THINKING "is thinking\n"
@@ -88,43 +106,254 @@
 # define EATING "is eating\n"
 // philo actions
 
+// philo events
+# define EVENT_FORK 0
+# define EVENT_EATING 1
+# define EVENT_SLEEPING 2
+# define EVENT_THINKING 3
+# define EVENT_DIED 4
+// philo events
+
+// logger
+// records each ring holds, a power of two
+# define LOG_RING 256
+// records each ring holds in fiber mode, where a worker logs for all
+// of its fibers
+# define LOG_FIBER_RING 16384
+// bytes the logger formats before each write
+# define LOG_BUFFER 65536
+// room left in the buffer for the longest line
+# define LOG_LINE 64
+// microseconds the logger sleeps between passes
+# define LOG_PERIOD 500
+// microseconds a thread waits for the logger when its ring is full
+# define LOG_WAIT 100
+// logger
+
+// fibers
+// flag before the parameters that runs the philosophers as fibers
+# define FIBERS_FLAG "--fibers"
+// bytes of stack each fiber gets, a multiple of the page size
+# define FIBER_STACK 16384
+// what a fiber asks its worker to do once it has switched back
+# define FIBER_RUN 0
+# define FIBER_SLEEP 1
+# define FIBER_FORK 2
+# define FIBER_DONE 3
+# define FIBER_LOG 4
+# define FIBER_SEAT 5
+// fibers
+
+// waiter
+// flag before the parameters that seats the philosophers by ticket
+# define WAITER_FLAG "--waiter"
+// flag before the parameters that prints the longest wait of each
+// philosopher for its forks once the simulation is over
+# define REPORT_FLAG "--report"
+// waiter
+
 // MACROS
 
 // STRUCTS
-// philos
-typedef struct s_philo
+// log record
+typedef struct s_record
 {
-	bool			*anyone_dead;
-	bool			eating;
+	size_t			time;
 	size_t			id;
+	int				event;
+}				t_record;
+// log record
+
+// log ring
+// A single producer ring: its philosopher (or the monitor) pushes at
+// head and the logger pops at tail. busy is set while a record is
+// being stamped, so the logger never prints past a record it has
+// not seen yet. What the producer writes and what the logger writes
+// sit on their own cache lines, apart from the neighbouring rings.
+typedef struct s_ring
+{
+	alignas(CACHE_LINE) atomic_size_t	head;
+	atomic_bool							busy;
+	size_t								mask;
+	t_record							*records;
+	alignas(CACHE_LINE) atomic_size_t	tail;
+}				t_ring;
+// log ring
+
+// logger
+// rings[0] belongs to the monitor and rings[id] to philosopher id, or
+// to worker id in fiber mode. watermark is the time below which every
+// record has been pushed.
+typedef struct s_logger
+{
+	t_ring			*rings;
+	t_record		*records;
+	size_t			*heap;
+	size_t			rings_amount;
+	size_t			heap_size;
 	size_t			start_timestamp;
-	size_t			last_meal_timestamp;
-	size_t			time_to_die_ms;
-	size_t			time_to_eat_ms;
-	size_t			time_to_sleep_ms;
-	size_t			num_meals;
-	size_t			philos_amount;
-	pthread_mutex_t	*left_fork;
-	pthread_mutex_t	*right_fork;
-	pthread_mutex_t	*dead_flag_lock;
-	pthread_mutex_t	*printf_lock;
-	pthread_mutex_t	*timestamp_lock;
-	pthread_mutex_t	meals_flag_lock;
+	size_t			watermark;
+	size_t			length;
+	bool			died;
+	bool			running;
+	atomic_bool		stop;
 	pthread_t		thread;
+	char			buffer[LOG_BUFFER];
+}				t_logger;
+// logger
+
+// fork
+// mutex is the fork of a thread. A fiber must not block its worker,
+// so in fiber mode taken and waiter, guarded by the scheduler lock,
+// are used instead: the neighbour a fork is busy for parks there.
+// Each fork fills a cache line of its own.
+typedef struct s_fork
+{
+	alignas(CACHE_LINE) pthread_mutex_t	mutex;
+	bool								taken;
+	struct s_fiber						*waiter;
+}				t_fork;
+// fork
+
+// philos
+// last_meal_timestamp, num_meals, eating and the flag anyone_dead
+// points to are shared with the monitor: they are written with
+// release and read with acquire ordering instead of being guarded by
+// mutexes. The fields the philosopher writes take the first cache
+// line. The read-mostly rest starts on the next one, so neither the
+// monitor reading a philosopher nor its neighbours eating evict it.
+typedef struct s_philo
+{
+	alignas(CACHE_LINE) atomic_size_t	last_meal_timestamp;
+	atomic_size_t						num_meals;
+	atomic_bool							eating;
+	size_t								max_wait_us;
+	alignas(CACHE_LINE) atomic_bool		*anyone_dead;
+	size_t								id;
+	size_t								start_timestamp;
+	size_t								time_to_die_ms;
+	size_t								time_to_eat_ms;
+	size_t								time_to_sleep_ms;
+	size_t								philos_amount;
+	t_fork								*left_fork;
+	t_fork								*right_fork;
+	t_ring								*ring;
+	struct s_monitor					*monitor;
+	struct s_fiber						*fiber;
+	struct s_waiter						*waiter;
+	pthread_t							thread;
 }				t_philo;
 // philos
 
+// fiber
+// A philosopher run as a stackful coroutine. action tells the worker
+// it switched back to why: to sleep until wake, to wait for fork, to
+// wait for room in the ring of the worker or because the philosopher
+// is done. next links the fibers waiting on the same ring.
+typedef struct s_fiber
+{
+	ucontext_t			context;
+	t_philo				*philo;
+	struct s_worker		*worker;
+	t_fork				*fork;
+	struct s_fiber		*next;
+	size_t				wake;
+	int					action;
+}				t_fiber;
+// fiber
+
+// timer
+// A sleeping fiber and its wake time, in microseconds. The time is
+// kept in the heap entry so sifting never touches the fibers.
+typedef struct s_timer
+{
+	size_t				wake;
+	t_fiber				*fiber;
+}				t_timer;
+// timer
+
+// worker
+// A thread running fibers; rings[id] of the logger is its own, since
+// the fibers it runs push their records one at a time. logging lists
+// the fibers parked until the logger makes room in it.
+typedef struct s_worker
+{
+	ucontext_t			context;
+	t_ring				*ring;
+	t_fiber				*logging;
+	struct s_sched		*sched;
+	pthread_t			thread;
+}				t_worker;
+// worker
+
+// scheduler
+// queue is a FIFO of ready fibers starting at queue_head and timers a
+// min-heap of sleeping ones by wake time, both guarded by lock. ready
+// is set once lock and wake are initialized.
+typedef struct s_sched
+{
+	pthread_mutex_t		lock;
+	pthread_cond_t		wake;
+	t_fiber				*fibers;
+	t_fiber				**queue;
+	t_timer				*timers;
+	t_worker			*workers;
+	char				*stacks;
+	size_t				fibers_amount;
+	size_t				workers_amount;
+	size_t				queue_head;
+	size_t				queue_size;
+	size_t				timers_size;
+	size_t				finished;
+	bool				ready;
+}				t_sched;
+// scheduler
+
+// waiter
+// Seats philosophers instead of letting them race for the forks: a
+// hungry philosopher takes a ticket and sits once neither neighbour
+// is seated nor holds an older ticket, so each neighbour eats at most
+// once while it waits. Threads wait on their seat, fibers are parked
+// until a neighbour leaving can seat them. Guarded by lock, which a
+// worker takes after the scheduler lock, never before.
+typedef struct s_waiter
+{
+	pthread_mutex_t		lock;
+	pthread_cond_t		*seats;
+	size_t				*tickets;
+	bool				*seated;
+	t_fiber				**parked;
+	size_t				amount;
+	size_t				next_ticket;
+	size_t				created_seats;
+	bool				ready;
+}				t_waiter;
+// waiter
+
+// deadline
+// The earliest time philosopher philo can die at, in milliseconds.
+typedef struct s_deadline
+{
+	size_t			time;
+	size_t			philo;
+}				t_deadline;
+// deadline
+
 // monitor
+// deadlines is a min-heap with one entry per philosopher. A meal
+// only ever moves a deadline later, so the monitor sleeps until the
+// earliest entry and refreshes it from last_meal_timestamp when it
+// wakes. wake is only signalled when everybody is satisfied.
 typedef struct s_monitor
 {
-	bool			anyone_dead;
+	atomic_bool		anyone_dead;
+	atomic_size_t	satisfied;
 	long			num_least_meals;
 	size_t			philos_amount;
-	pthread_mutex_t	dead_flag_lock;
-	pthread_mutex_t	printf_lock;
-	pthread_mutex_t	meals_flag_lock;
-	pthread_mutex_t	timestamp_lock;
-	pthread_t		thread;
+	pthread_mutex_t	wake_lock;
+	pthread_cond_t	wake;
+	t_deadline		*deadlines;
+	t_logger		logger;
 	t_philo			*philos;
 }				t_monitor;
 // monitor
@@ -134,11 +363,16 @@ typedef struct s_program
 {
 	int				ac;
 	char			**av;
+	bool			fibers;
+	bool			use_waiter;
+	bool			report;
 	size_t			philos_amount;
 	size_t			created_forks_mutexes;
 	t_monitor		*monitor;
 	t_philo			*philos;
-	pthread_mutex_t	*forks;
+	t_fork			*forks;
+	t_sched			sched;
+	t_waiter		waiter;
 }		t_program;
 // program
 // STRUCTS
@@ -151,6 +385,19 @@ void			go_sleep(t_philo *philo);
 void			go_think(t_philo *philo);
 // atomic routines
 
+// clock
+size_t			clock_us(void);
+size_t			timestamp(void);
+void			sleep_until(size_t deadline);
+void			uwait(size_t milliseconds);
+void			philo_wait(t_philo *philo, size_t microseconds);
+// clock
+
+// deadline
+void			deadline_init(t_monitor *monitor);
+void			deadline_sift(t_monitor *monitor, size_t i);
+// deadline
+
 // error handler
 void			no_num_param_error(void);
 void			wrong_param_amount_error(void);
@@ -163,17 +410,55 @@ void			pthread_create_error(void);
 void			malloc_error(void);
 void			mutex_destroy_error(void);
 void			pthread_join_error(void);
-void			gettimeofday_error(void);
+void			clock_error(void);
 void			no_philo_error(void);
 // error handler 2
 
+// fiber
+void			fiber_entry(unsigned int high, unsigned int low);
+void			fiber_resume(t_worker *worker, t_fiber *fiber);
+void			fiber_park(t_fiber *fiber, int action);
+void			fiber_take(t_fiber *fiber, t_fork *fork);
+void			fiber_put(t_fiber *fiber, t_fork *fork);
+// fiber
+
 // forks
-pthread_mutex_t	*create_forks(size_t num_of_philos);
+t_fork			*create_forks(size_t num_of_philos);
 bool			init_forks(t_program *program, size_t num_of_philos);
+void			fork_take(t_philo *philo, t_fork *fork);
+void			fork_put(t_philo *philo, t_fork *fork);
+void			forks_put(t_philo *philo);
 // forks
 
+// log format
+void			log_record(t_logger *logger, t_record *record);
+void			log_flush(t_logger *logger);
+// log format
+
+// log heap
+void			heap_push(t_logger *logger, size_t ring);
+size_t			heap_pop(t_logger *logger);
+// log heap
+
+// log ring
+void			rings_init(t_ring *rings, t_record *records, size_t amount,
+					size_t size);
+bool			ring_full(t_ring *ring);
+bool			log_push(t_ring *ring, size_t id, int event);
+void			ring_offer(t_logger *logger, size_t ring, size_t watermark);
+// log ring
+
+// logger
+bool			logger_init(t_logger *logger, size_t rings_amount,
+					size_t ring_size);
+void			logger_stop(t_logger *logger);
+void			*logger_routine(void *log);
+void			log_pass(t_logger *logger, size_t watermark);
+// logger
+
 // memory
 void			destroy_mutexes(pthread_mutex_t *forks, size_t num_of_philos);
+void			destroy_forks(t_fork *forks, size_t num_of_forks);
 void			free_project(t_program *program,
 					size_t level, void (*call_back_fn)(void));
 void			destroy_monitor(t_monitor *monitor, size_t level);
@@ -181,23 +466,23 @@ void			destroy_monitor(t_monitor *monitor, size_t level);
 
 // monitor routine
 void			*monitor_routine(void *moni);
-bool			check_if_alive(t_philo *philo);
-bool			is_anyone_dead(t_philo *philos);
-bool			enough_meals_checker(t_philo *philo, t_monitor *monitor);
-bool			is_everybody_satisfied(t_monitor *monitor, t_philo *philos);
+void			monitor_stop(t_monitor *monitor);
+void			meal_eaten(t_philo *philo);
 // monitor routine
 
 // monitor
 bool			init_monitor(t_program *program, char **av);
-bool			init_meal_lock(t_program *program, size_t philos_amount);
 bool			init_monitor_1(t_program *program);
 bool			init_monitor_2(t_program *program);
+bool			init_clock_cond(pthread_cond_t *cond);
 // monitor
 
 // params_checker
 bool			is_num(int c);
 bool			is_param_valid(char *str);
 bool			check_all_params(char **av);
+bool			check_flag(t_program *program, char *arg);
+int				check_flags(t_program *program, int *ac, char **av);
 // params_checker
 
 // philo routine
@@ -213,19 +498,49 @@ void			philos_attributes(char **av,
 					t_philo *philos, t_monitor *monitor);
 // philos
 
+// sched
+bool			sched_init(t_sched *sched, size_t fibers_amount);
+void			sched_destroy(t_sched *sched);
+bool			sched_start(t_program *program);
+bool			sched_join(t_sched *sched);
+// sched
+
+// sched queue
+void			run_push(t_sched *sched, t_fiber *fiber);
+void			timer_push(t_sched *sched, t_fiber *fiber);
+t_fiber			*sched_next(t_sched *sched);
+void			sched_idle(t_sched *sched, size_t until);
+// sched queue
+
+// report
+void			report_waits(t_program *program);
+// report
+
 // program
 bool			init_program(int ac, char **av,
 					t_program *program, t_monitor *monitor);
 bool			run_program(t_program *program);
-void			printf_msg(t_philo *philo, const char *str);
+void			log_msg(t_philo *philo, int event);
 bool			check_dead_flag(t_philo *philo);
 // program
 
 // utils
 size_t			ft_strlen(const char *str);
 size_t			ft_atoul(const char *str);
-void			uwait(size_t microseconds);
-size_t			timestamp(void);
 long			abs_value(long value);
+int				ft_strcmp(const char *s1, const char *s2);
 // utils
+
+// waiter
+bool			waiter_init(t_waiter *waiter, size_t amount);
+void			waiter_destroy(t_waiter *waiter);
+bool			waiter_seat(t_waiter *waiter, size_t i);
+void			waiter_sit(t_philo *philo);
+void			waiter_leave(t_philo *philo);
+// waiter
+
+// worker
+void			worker_wake(t_fiber *fiber);
+void			*worker_routine(void *arg);
+// worker
 #endif
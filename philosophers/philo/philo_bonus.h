@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_bonus.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/12 10:14:52 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/12 10:14:52 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_BONUS_H
+# define PHILO_BONUS_H
+
+# include "philo.h"
+# include <fcntl.h>
+# include <semaphore.h>
+# include <signal.h>
+# include <sys/mman.h>
+# include <sys/wait.h>
+
+// MACROS
+// wrong parameter amount error message
+# define BONUS_USAGE_MESSAGE "usage: <number_of_philosophers>"
+// wrong parameter amount error message
+
+// semaphore error message
+# define SEM_ERROR_MESSAGE "Error: Semaphore failed!\n"
+// semaphore error message
+
+// mmap error message
+# define MMAP_ERROR_MESSAGE "Error: Mmap failed!\n"
+// mmap error message
+
+// fork error message
+# define FORK_ERROR_MESSAGE "Error: Fork failed!\n"
+// fork error message
+
+// semaphores
+// names the semaphores are opened by, followed by the pid of the
+// parent so that two simulations never share them
+# define SEM_FORKS "/philo_forks_"
+# define SEM_ROOM "/philo_room_"
+# define SEM_PRINT "/philo_print_"
+# define SEM_START "/philo_start_"
+// bytes a name takes, its terminator included
+# define SEM_NAME 32
+// semaphores
+// MACROS
+
+// STRUCTS
+// seat
+// What the process of a philosopher shares with the others: written by
+// the philosopher, read by its watchdog and the parent. Each seat fills
+// a cache line of its own.
+typedef struct s_seat
+{
+	alignas(CACHE_LINE) atomic_size_t	last_meal_timestamp;
+	atomic_size_t						num_meals;
+	atomic_bool							eating;
+}				t_seat;
+// seat
+
+// table
+// The region mapped shared before the philosophers are forked. stop is
+// set, under the print semaphore, by the process that prints a death
+// or serves the last meal needed, so nothing is printed after it.
+typedef struct s_table
+{
+	atomic_bool		stop;
+	atomic_size_t	satisfied;
+	size_t			start_timestamp;
+	size_t			size;
+	t_seat			seats[];
+}				t_table;
+// table
+
+// diner
+// The state of one process: the parent fills it in, each child it
+// forks sets its own id. forks is the pool the philosophers take two
+// forks from and room lets at most half of them reach for it, so they
+// can never all hold one fork. logger only formats and writes lines.
+typedef struct s_diner
+{
+	size_t			id;
+	size_t			philos_amount;
+	size_t			time_to_die_ms;
+	size_t			time_to_eat_ms;
+	size_t			time_to_sleep_ms;
+	long			num_least_meals;
+	t_table			*table;
+	t_seat			*seat;
+	sem_t			*forks;
+	sem_t			*room;
+	sem_t			*print;
+	sem_t			*start;
+	pid_t			*pids;
+	pthread_t		watchdog;
+	t_logger		logger;
+}				t_diner;
+// diner
+// STRUCTS
+
+// diner
+void			diner_log(t_diner *diner, int event);
+void			diner_routine(t_diner *diner);
+// diner
+
+// error bonus
+void			bonus_usage_error(void);
+void			sem_error(void);
+void			mmap_error(void);
+void			fork_error(void);
+// error bonus
+
+// host
+bool			host_run(t_diner *diner);
+// host
+
+// table
+bool			table_open(t_diner *diner);
+void			table_close(t_diner *diner);
+// table
+
+// watchdog
+void			*watchdog_routine(void *arg);
+// watchdog
+#endif
@@ -25,7 +25,7 @@ void	*philo_routine(void *phi)
 			&& philo->id == philo->philos_amount))
 	{
 		go_think(philo);
-		uwait(1);
+		philo_wait(philo, MICROSECONDS_IN_A_MILLISECOND);
 	}
 	while (!check_dead_flag(philo))
 	{
@@ -13,7 +13,8 @@
 #include "philo.h"
 
 /// @brief This function initializes the program, returns true if succeed,
-// otherwise returns false.
+// otherwise returns false. In fiber mode it runs a worker per core,
+// but never more workers than philosophers.
 /// @param ac 
 /// @param av 
 /// @param program 
@@ -21,11 +22,24 @@
 /// @return 
 bool	init_program(int ac, char **av, t_program *program, t_monitor *monitor)
 {
+	long	cores;
+
 	program->ac = ac;
 	program->av = av;
 	program->monitor = monitor;
 	program->philos_amount = ft_atoul(*av);
 	program->created_forks_mutexes = 0;
+	memset(&program->sched, 0, sizeof(t_sched));
+	memset(&program->waiter, 0, sizeof(t_waiter));
+	if (program->philos_amount == 1)
+		program->use_waiter = false;
+	cores = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cores < 1)
+		cores = 1;
+	if ((size_t)cores > program->philos_amount)
+		cores = program->philos_amount;
+	if (program->fibers)
+		program->sched.workers_amount = cores;
 	if (!init_monitor(program, av))
 		return (false);
 	if (!init_forks(program, program->philos_amount))
@@ -36,19 +50,27 @@ bool	init_program(int ac, char **av, t_program *program, t_monitor *monitor)
 }
 
 /// @brief This function executes for each thread the join function,
-// in case of success it reutrns true, otherwise false.
+// in case of success it reutrns true, otherwise false. In fiber mode
+// the workers are joined instead.
 /// @param program 
 /// @return 
 bool	run_program(t_program *program)
 {
 	size_t	i;
 
+	if (program->fibers && !sched_join(&program->sched))
+	{
+		free_project(program, FP_LEVEL_5, &pthread_join_error);
+		return (false);
+	}
 	i = 0;
+	if (program->fibers)
+		i = program->philos_amount;
 	while (i < program->philos_amount)
 	{
 		if (pthread_join(program->philos[i].thread, NULL))
 		{
-			free_project(program, FP_LEVEL_6, &pthread_join_error);
+			free_project(program, FP_LEVEL_5, &pthread_join_error);
 			return (false);
 		}
 		i++;
@@ -56,19 +78,23 @@ bool	run_program(t_program *program)
 	return (true);
 }
 
-/// @brief This function writes the given message in the terminal
-// with the timestamp, and philosopher id.
+/// @brief This function hands the given event to the logger, which
+// prints it with its timestamp and the philosopher id. While the ring
+// is full a thread waits for the logger, unless someone has died, in
+// which case the record would never be printed anyway. A fiber parks
+// instead, so the other fibers of its worker keep running.
 /// @param philo 
-/// @param str 
-void	printf_msg(t_philo *philo, const char *str)
+/// @param event 
+void	log_msg(t_philo *philo, int event)
 {
-	pthread_mutex_lock(philo->printf_lock);
-	pthread_mutex_lock(philo->timestamp_lock);
-	if (!check_dead_flag(philo))
-		printf("%li %li %s", timestamp() - philo->start_timestamp,
-			philo->id, str);
-	pthread_mutex_unlock(philo->timestamp_lock);
-	pthread_mutex_unlock(philo->printf_lock);
+	while (!check_dead_flag(philo)
+		&& !log_push(philo->ring, philo->id, event))
+	{
+		if (philo->fiber)
+			fiber_park(philo->fiber, FIBER_LOG);
+		else
+			usleep(LOG_WAIT);
+	}
 }
 
 /// @brief This function checks if any philosopher has died,
@@ -77,14 +103,7 @@ void	printf_msg(t_philo *philo, const char *str)
 /// @return 
 bool	check_dead_flag(t_philo *philo)
 {
-	pthread_mutex_lock(philo->dead_flag_lock);
-	if (*philo->anyone_dead)
-	{
-		pthread_mutex_unlock(philo->dead_flag_lock);
-		return (true);
-	}
-	pthread_mutex_unlock(philo->dead_flag_lock);
-	return (false);
+	return (atomic_load_explicit(philo->anyone_dead, memory_order_acquire));
 }
 
 /// @brief This function initializes the threads, if it succeed returns true,
@@ -100,6 +119,8 @@ bool	init_threads(t_philo *philos, size_t philos_amount)
 	i = 0;
 	while (i < philos_amount)
 	{
+		philos[i].fiber = NULL;
+		philos[i].ring = &philos[i].monitor->logger.rings[i + 1];
 		if (pthread_create(&philos[i].thread, NULL, &philo_routine, &philos[i]))
 			return (false);
 		i++;
@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   report.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/11 11:03:27 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/11 11:03:27 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function prints, once the simulation is over, how many
+// meals each philosopher had and the longest it waited for its forks,
+// then the worst and mean of those waits and the meals per second.
+// It goes to the error output, apart from the log.
+/// @param program 
+void	report_waits(t_program *program)
+{
+	t_philo	*philo;
+	t_philo	*worst;
+	size_t	meals;
+	size_t	sum;
+	size_t	i;
+
+	worst = program->philos;
+	meals = 0;
+	sum = 0;
+	i = 0;
+	fprintf(stderr, "# philosopher meals max_wait_ms\n");
+	while (i < program->philos_amount)
+	{
+		philo = &program->philos[i++];
+		meals += atomic_load(&philo->num_meals);
+		sum += philo->max_wait_us;
+		if (philo->max_wait_us > worst->max_wait_us)
+			worst = philo;
+		fprintf(stderr, "%zu %zu %.3f\n", philo->id,
+			atomic_load(&philo->num_meals), philo->max_wait_us / 1e3);
+	}
+	fprintf(stderr, "# worst %.3f ms (philosopher %zu), mean %.3f ms, "
+		"%zu meals, %.1f meals/s\n", worst->max_wait_us / 1e3, worst->id,
+		sum / 1e3 / program->philos_amount, meals, meals * 1e3
+		/ (timestamp() - program->monitor->logger.start_timestamp));
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sched.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/10 11:29:46 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/10 11:29:46 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function allocates the fibers, their stacks and the
+// queues of the scheduler, and initializes its lock and condition.
+// workers_amount must be set beforehand. The stacks are aligned, so
+// the top of a fiber that never goes deep stays within one page.
+/// @param sched 
+/// @param fibers_amount 
+/// @return 
+bool	sched_init(t_sched *sched, size_t fibers_amount)
+{
+	sched->fibers_amount = fibers_amount;
+	sched->fibers = (t_fiber *)malloc(sizeof(t_fiber) * fibers_amount);
+	sched->queue = (t_fiber **)malloc(sizeof(t_fiber *) * fibers_amount);
+	sched->timers = (t_timer *)malloc(sizeof(t_timer) * fibers_amount);
+	sched->workers = (t_worker *)malloc(sizeof(t_worker)
+			* sched->workers_amount);
+	if (posix_memalign((void **)&sched->stacks, FIBER_STACK,
+			FIBER_STACK * fibers_amount))
+		sched->stacks = NULL;
+	if (!sched->fibers || !sched->queue || !sched->timers
+		|| !sched->workers || !sched->stacks)
+		return (false);
+	if (pthread_mutex_init(&sched->lock, NULL))
+		return (false);
+	if (!init_clock_cond(&sched->wake))
+	{
+		pthread_mutex_destroy(&sched->lock);
+		return (false);
+	}
+	sched->ready = true;
+	return (true);
+}
+
+/// @brief This function deallocates whatever sched_init allocated.
+/// @param sched 
+void	sched_destroy(t_sched *sched)
+{
+	if (sched->ready)
+	{
+		pthread_mutex_destroy(&sched->lock);
+		pthread_cond_destroy(&sched->wake);
+	}
+	free(sched->fibers);
+	free(sched->queue);
+	free(sched->timers);
+	free(sched->workers);
+	free(sched->stacks);
+}
+
+/// @brief This function makes every philosopher a fiber with its own
+// stack and queues it, ready to run.
+/// @param sched 
+/// @param philos 
+static void	fibers_setup(t_sched *sched, t_philo *philos)
+{
+	t_fiber	*fiber;
+	size_t	i;
+
+	i = 0;
+	while (i < sched->fibers_amount)
+	{
+		fiber = &sched->fibers[i];
+		fiber->philo = &philos[i];
+		fiber->worker = NULL;
+		fiber->fork = NULL;
+		fiber->wake = 0;
+		fiber->action = FIBER_RUN;
+		philos[i].fiber = fiber;
+		philos[i].ring = NULL;
+		getcontext(&fiber->context);
+		fiber->context.uc_stack.ss_sp = sched->stacks + i * FIBER_STACK;
+		fiber->context.uc_stack.ss_size = FIBER_STACK;
+		fiber->context.uc_link = NULL;
+		makecontext(&fiber->context, (void (*)(void))(uintptr_t)&fiber_entry,
+			2, (unsigned int)((uintptr_t)fiber >> 16 >> 16),
+			(unsigned int)(uintptr_t)fiber);
+		sched->queue[i++] = fiber;
+	}
+	sched->queue_size = sched->fibers_amount;
+}
+
+/// @brief This function queues every philosopher as a fiber and starts
+// the workers. If only some workers could be created, the others run
+// the fibers; if none could, it deallocates everything.
+/// @param program 
+/// @return 
+bool	sched_start(t_program *program)
+{
+	t_sched	*sched;
+	size_t	i;
+
+	sched = &program->sched;
+	if (!sched_init(sched, program->philos_amount))
+	{
+		free_project(program, FP_LEVEL_5, &malloc_error);
+		return (false);
+	}
+	fibers_setup(sched, program->philos);
+	i = 0;
+	while (i < sched->workers_amount)
+	{
+		sched->workers[i].ring = &program->monitor->logger.rings[i + 1];
+		sched->workers[i].sched = sched;
+		sched->workers[i].logging = NULL;
+		if (pthread_create(&sched->workers[i].thread, NULL,
+				&worker_routine, &sched->workers[i]))
+			break ;
+		i++;
+	}
+	sched->workers_amount = i;
+	if (!i)
+		free_project(program, FP_LEVEL_5, &pthread_create_error);
+	return (i > 0);
+}
+
+/// @brief This function waits for every worker to return, which they
+// do once all the fibers are done.
+/// @param sched 
+/// @return 
+bool	sched_join(t_sched *sched)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < sched->workers_amount)
+	{
+		if (pthread_join(sched->workers[i].thread, NULL))
+			return (false);
+		i++;
+	}
+	return (true);
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sched_queue.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/10 11:27:50 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/10 11:27:50 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function appends a fiber to the ready queue and wakes
+// an idle worker to run it.
+/// @param sched 
+/// @param fiber 
+void	run_push(t_sched *sched, t_fiber *fiber)
+{
+	sched->queue[(sched->queue_head + sched->queue_size)
+		% sched->fibers_amount] = fiber;
+	sched->queue_size++;
+	pthread_cond_signal(&sched->wake);
+}
+
+/// @brief This function pushes a sleeping fiber to the timer heap. An
+// idle worker is woken when it became the earliest one.
+/// @param sched 
+/// @param fiber 
+void	timer_push(t_sched *sched, t_fiber *fiber)
+{
+	t_timer	*timers;
+	size_t	i;
+
+	timers = sched->timers;
+	i = sched->timers_size++;
+	while (i && timers[(i - 1) / 2].wake > fiber->wake)
+	{
+		timers[i] = timers[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+	timers[i].wake = fiber->wake;
+	timers[i].fiber = fiber;
+	if (!i)
+		pthread_cond_signal(&sched->wake);
+}
+
+/// @brief This function pops the earliest fiber of the timer heap.
+/// @param sched 
+/// @return 
+static t_fiber	*timer_pop(t_sched *sched)
+{
+	t_timer	*timers;
+	t_fiber	*top;
+	t_timer	last;
+	size_t	i;
+	size_t	child;
+
+	timers = sched->timers;
+	top = timers[0].fiber;
+	last = timers[--sched->timers_size];
+	i = 0;
+	child = 1;
+	while (child < sched->timers_size)
+	{
+		if (child + 1 < sched->timers_size
+			&& timers[child + 1].wake < timers[child].wake)
+			child++;
+		if (last.wake <= timers[child].wake)
+			break ;
+		timers[i] = timers[child];
+		i = child;
+		child = 2 * i + 1;
+	}
+	timers[i] = last;
+	return (top);
+}
+
+/// @brief This function moves the fibers whose wake time is reached to
+// the ready queue, then pops the next one to run, if any.
+/// @param sched 
+/// @return 
+t_fiber	*sched_next(t_sched *sched)
+{
+	t_fiber	*fiber;
+	size_t	now;
+
+	if (sched->timers_size)
+	{
+		now = clock_us();
+		while (sched->timers_size && sched->timers[0].wake <= now)
+			run_push(sched, timer_pop(sched));
+	}
+	if (!sched->queue_size)
+		return (NULL);
+	fiber = sched->queue[sched->queue_head];
+	sched->queue_head = (sched->queue_head + 1) % sched->fibers_amount;
+	sched->queue_size--;
+	return (fiber);
+}
+
+/// @brief This function waits until the earliest timer is due, a fiber
+// is ready or until has come, whichever is first. Called with the lock
+// held.
+/// @param sched 
+/// @param until microseconds, or SIZE_MAX for no limit
+void	sched_idle(t_sched *sched, size_t until)
+{
+	struct timespec	wake;
+
+	if (sched->timers_size && sched->timers[0].wake < until)
+		until = sched->timers[0].wake;
+	if (until == SIZE_MAX)
+	{
+		pthread_cond_wait(&sched->wake, &sched->lock);
+		return ;
+	}
+	wake.tv_sec = until / MICROSECONDS_IN_A_SECOND;
+	wake.tv_nsec = until % MICROSECONDS_IN_A_SECOND
+		* NANOSECONDS_IN_A_MICROSECOND;
+	pthread_cond_timedwait(&sched->wake, &sched->lock, &wake);
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   table_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/12 11:02:36 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/12 11:02:36 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/// @brief This function writes into name the prefix followed by the pid
+// of the process.
+/// @param name 
+/// @param prefix 
+static void	sem_name(char *name, const char *prefix)
+{
+	char	digits[20];
+	size_t	length;
+	size_t	i;
+	pid_t	pid;
+
+	length = ft_strlen(prefix);
+	memcpy(name, prefix, length);
+	pid = getpid();
+	i = 0;
+	while (pid || !i)
+	{
+		digits[i++] = '0' + pid % 10;
+		pid /= 10;
+	}
+	while (i)
+		name[length++] = digits[--i];
+	name[length] = '\0';
+}
+
+/// @brief This function creates a named semaphore with the given value
+// and unlinks its name at once: the processes forked afterwards share
+// it, and nothing is left behind however the program ends. Returns
+// NULL if it fails.
+/// @param prefix 
+/// @param value 
+/// @return 
+static sem_t	*sem_create(const char *prefix, unsigned int value)
+{
+	char	name[SEM_NAME];
+	sem_t	*sem;
+
+	sem_name(name, prefix);
+	sem_unlink(name);
+	sem = sem_open(name, O_CREAT | O_EXCL, 0600, value);
+	sem_unlink(name);
+	if (sem == SEM_FAILED)
+		return (NULL);
+	return (sem);
+}
+
+/// @brief This function maps the table shared by the processes, with a
+// seat for each philosopher, returns false if it fails.
+/// @param diner 
+/// @return 
+static bool	table_map(t_diner *diner)
+{
+	size_t	size;
+	void	*table;
+
+	size = sizeof(t_table) + sizeof(t_seat) * diner->philos_amount;
+	table = mmap(NULL, size, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (table == MAP_FAILED)
+		return (false);
+	diner->table = table;
+	atomic_init(&diner->table->stop, false);
+	atomic_init(&diner->table->satisfied, 0);
+	diner->table->size = size;
+	return (true);
+}
+
+/// @brief This function maps the table and opens the semaphores, returns
+// false, having closed whatever it opened, if it fails.
+/// @param diner 
+/// @return 
+bool	table_open(t_diner *diner)
+{
+	size_t	room;
+
+	if (!table_map(diner))
+	{
+		mmap_error();
+		return (false);
+	}
+	room = diner->philos_amount / 2;
+	if (!room)
+		room = 1;
+	diner->forks = sem_create(SEM_FORKS, diner->philos_amount);
+	diner->room = sem_create(SEM_ROOM, room);
+	diner->print = sem_create(SEM_PRINT, 1);
+	diner->start = sem_create(SEM_START, 0);
+	if (!diner->forks || !diner->room || !diner->print || !diner->start)
+	{
+		sem_error();
+		table_close(diner);
+		return (false);
+	}
+	return (true);
+}
+
+/// @brief This function unmaps the table and closes the semaphores that
+// were opened.
+/// @param diner 
+void	table_close(t_diner *diner)
+{
+	if (diner->forks)
+		sem_close(diner->forks);
+	if (diner->room)
+		sem_close(diner->room);
+	if (diner->print)
+		sem_close(diner->print);
+	if (diner->start)
+		sem_close(diner->start);
+	if (diner->table)
+		munmap(diner->table, diner->table->size);
+	diner->table = NULL;
+}
@@ -0,0 +1,57 @@
+#!/bin/sh
+# Runs philo at 200 philosophers, built with -fsanitize=thread by
+# make stress, and fails on any ThreadSanitizer report, on a run
+# that does not end, on more than one death, on timestamps going
+# back or on a line printed after the death.
+# usage: tests/stress.sh <philo binary>
+
+PHILO=${1:-./philo_tsan}
+TIMEOUT=120
+FAILED=0
+
+# run <deaths> <args...>: deaths is "one" when a philosopher must
+# die, "any" when the run may end on either a death or the meals
+run()
+{
+	DEATHS=$1
+	shift
+	OUT=$(timeout $TIMEOUT "$PHILO" "$@" 2>&1)
+	STATUS=$?
+	DIED=$(printf '%s\n' "$OUT" | grep -c ' died$')
+	BACK=$(printf '%s\n' "$OUT" | awk 'NF && $1 < t { print NR; exit }
+		{ t = $1 }')
+	AFTER=$(printf '%s\n' "$OUT" | awk 'NF && d { print NR; exit }
+		/ died$/ { d = 1 }')
+	ERROR=""
+	if [ $STATUS -eq 124 ]; then
+		ERROR="did not end in ${TIMEOUT}s"
+	elif printf '%s\n' "$OUT" | grep -q 'ThreadSanitizer'; then
+		ERROR="ThreadSanitizer report"
+	elif [ $STATUS -ne 0 ]; then
+		ERROR="exit status $STATUS"
+	elif [ "$DIED" -gt 1 ]; then
+		ERROR="$DIED deaths printed"
+	elif [ -n "$BACK" ]; then
+		ERROR="timestamp going back at line $BACK"
+	elif [ -n "$AFTER" ]; then
+		ERROR="line $AFTER printed after the death"
+	elif [ "$DEATHS" = one ] && [ "$DIED" -ne 1 ]; then
+		ERROR="no death printed"
+	fi
+	if [ -n "$ERROR" ]; then
+		printf 'KO  %s: %s\n' "$*" "$ERROR"
+		printf '%s\n' "$OUT" | grep -A 20 'ThreadSanitizer' | head -40
+		FAILED=1
+	else
+		printf 'OK  %s (%s lines, %s died)\n' "$*" \
+			"$(printf '%s\n' "$OUT" | wc -l)" "$DIED"
+	fi
+}
+
+run any 200 800 200 200 5
+run any 200 410 200 200 3
+run any 199 610 200 200 3
+run one 200 310 200 100
+run one 200 120 60 60
+run one 200 800 400 500
+exit $FAILED
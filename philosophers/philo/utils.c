@@ -36,41 +36,18 @@ size_t	ft_atoul(const char *str)
 	return (res);
 }
 
-/// @brief This function pause the process for the amount of milliseconds
-// given as parameter.
-/// @param milliseconds 
-void	uwait(size_t milliseconds)
+/// @brief This function compares two strings.
+/// @param s1 
+/// @param s2 
+/// @return 
+int	ft_strcmp(const char *s1, const char *s2)
 {
-	struct timeval	start;
-	struct timeval	curr;
-	size_t			elapsed;
-	size_t			end;
-
-	if (gettimeofday(&start, NULL) == -1)
-		gettimeofday_error();
-	end = (start.tv_sec * 1000 + start.tv_usec / 1000) + milliseconds; 
-	while (1)
+	while (*s1 && *s1 == *s2)
 	{
-		if (gettimeofday(&curr, NULL) == -1)
-			gettimeofday_error();
-		elapsed = curr.tv_sec * 1000 + curr.tv_usec / 1000;
-		if (elapsed >= end)
-			return ;
-		usleep(100);
+		s1++;
+		s2++;
 	}
-}
-
-/// @brief This function calculates and returns the timestamp in milliseconds.
-/// @param  
-/// @return 
-size_t	timestamp(void)
-{
-	struct timeval	now;
-
-	if (gettimeofday(&now, NULL) == -1)
-		gettimeofday_error();
-	return (now.tv_sec * MILLISECONDS_IN_A_SECOND
-		+ now.tv_usec / MICROSECONDS_IN_A_MILLISECOND);
+	return ((unsigned char)*s1 - (unsigned char)*s2);
 }
 
 /// @brief This function returns the absolute value given as parameter.
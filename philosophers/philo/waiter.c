@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   waiter.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/11 10:14:52 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/11 10:14:52 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function allocates the seats of the waiter, one per
+// philosopher, and initializes its lock and their conditions.
+/// @param waiter 
+/// @param amount 
+/// @return 
+bool	waiter_init(t_waiter *waiter, size_t amount)
+{
+	waiter->amount = amount;
+	waiter->next_ticket = 0;
+	waiter->seats = (pthread_cond_t *)malloc(sizeof(pthread_cond_t) * amount);
+	waiter->tickets = (size_t *)calloc(amount, sizeof(size_t));
+	waiter->seated = (bool *)calloc(amount, sizeof(bool));
+	waiter->parked = (t_fiber **)calloc(amount, sizeof(t_fiber *));
+	if (!waiter->seats || !waiter->tickets || !waiter->seated
+		|| !waiter->parked || pthread_mutex_init(&waiter->lock, NULL))
+		return (false);
+	waiter->ready = true;
+	while (waiter->created_seats < amount)
+	{
+		if (pthread_cond_init(&waiter->seats[waiter->created_seats], NULL))
+			return (false);
+		waiter->created_seats++;
+	}
+	return (true);
+}
+
+/// @brief This function deallocates whatever waiter_init allocated.
+/// @param waiter 
+void	waiter_destroy(t_waiter *waiter)
+{
+	if (waiter->ready)
+		destroy_mutexes(&waiter->lock, 1);
+	while (waiter->created_seats)
+		pthread_cond_destroy(&waiter->seats[--waiter->created_seats]);
+	free(waiter->seats);
+	free(waiter->tickets);
+	free(waiter->seated);
+	free(waiter->parked);
+}
+
+/// @brief This function seats philosopher i, returns false if one of
+// its neighbours is seated or has been hungry for longer. Called with
+// the lock held.
+/// @param waiter 
+/// @param i 
+/// @return 
+bool	waiter_seat(t_waiter *waiter, size_t i)
+{
+	size_t	left;
+	size_t	right;
+
+	left = (i + waiter->amount - 1) % waiter->amount;
+	right = (i + 1) % waiter->amount;
+	if (waiter->seated[left] || waiter->seated[right])
+		return (false);
+	if ((waiter->tickets[left] && waiter->tickets[left] < waiter->tickets[i])
+		|| (waiter->tickets[right]
+			&& waiter->tickets[right] < waiter->tickets[i]))
+		return (false);
+	waiter->seated[i] = true;
+	waiter->tickets[i] = 0;
+	return (true);
+}
+
+/// @brief This function takes a ticket for the philosopher and returns
+// once it is seated, with both forks free for it.
+/// @param philo 
+void	waiter_sit(t_philo *philo)
+{
+	t_waiter	*waiter;
+	size_t		i;
+	bool		seated;
+
+	waiter = philo->waiter;
+	i = philo->id - 1;
+	pthread_mutex_lock(&waiter->lock);
+	waiter->tickets[i] = ++waiter->next_ticket;
+	seated = waiter_seat(waiter, i);
+	while (!seated && !philo->fiber)
+	{
+		pthread_cond_wait(&waiter->seats[i], &waiter->lock);
+		seated = waiter_seat(waiter, i);
+	}
+	pthread_mutex_unlock(&waiter->lock);
+	if (!seated)
+		fiber_park(philo->fiber, FIBER_SEAT);
+	log_msg(philo, EVENT_FORK);
+	log_msg(philo, EVENT_FORK);
+}
+
+/// @brief This function gets the philosopher up and lets its right,
+// then its left neighbour know: a parked fiber the seat is now free
+// for is seated and woken.
+/// @param philo 
+void	waiter_leave(t_philo *philo)
+{
+	t_waiter	*waiter;
+	t_fiber		*woken[2];
+	size_t		next;
+	int			k;
+
+	waiter = philo->waiter;
+	pthread_mutex_lock(&waiter->lock);
+	waiter->seated[philo->id - 1] = false;
+	k = -1;
+	while (++k < 2)
+	{
+		next = (philo->id + k * (waiter->amount - 2)) % waiter->amount;
+		woken[k] = NULL;
+		if (waiter->parked[next] && waiter_seat(waiter, next))
+		{
+			woken[k] = waiter->parked[next];
+			waiter->parked[next] = NULL;
+		}
+		pthread_cond_signal(&waiter->seats[next]);
+	}
+	pthread_mutex_unlock(&waiter->lock);
+	k = -1;
+	while (++k < 2)
+		if (woken[k])
+			worker_wake(woken[k]);
+}
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   watchdog_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/12 11:58:03 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/12 11:58:03 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/// @brief This function watches the philosopher of its process, sleeping
+// until the earliest time it could die: if it ate since, it sleeps
+// until its new deadline, if it is eating it checks again in a
+// millisecond, otherwise it prints the death and ends the process.
+/// @param arg 
+/// @return 
+void	*watchdog_routine(void *arg)
+{
+	t_diner	*diner;
+	size_t	deadline;
+	size_t	meal;
+
+	diner = (t_diner *)arg;
+	deadline = diner->table->start_timestamp + diner->time_to_die_ms;
+	while (!atomic_load_explicit(&diner->table->stop, memory_order_acquire))
+	{
+		sleep_until(deadline * MICROSECONDS_IN_A_MILLISECOND);
+		meal = atomic_load_explicit(&diner->seat->last_meal_timestamp,
+				memory_order_acquire) + diner->time_to_die_ms;
+		if (meal > deadline)
+			deadline = meal;
+		else if (atomic_load_explicit(&diner->seat->eating,
+				memory_order_acquire))
+			deadline = timestamp() + 1;
+		else
+		{
+			diner_log(diner, EVENT_DIED);
+			exit(0);
+		}
+	}
+	return (arg);
+}
@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   worker.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: arabelo- <arabelo-@student.42lisboa.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2023/12/10 11:23:11 by arabelo-          #+#    #+#             */
+/*   Updated: 2023/12/10 11:23:11 by arabelo-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/// @brief This function seats the fiber if it can eat now, otherwise
+// parks it with the waiter until a neighbour leaving seats it.
+// Called with the lock held.
+/// @param sched 
+/// @param fiber 
+static void	worker_seat(t_sched *sched, t_fiber *fiber)
+{
+	t_waiter	*waiter;
+	size_t		i;
+
+	waiter = fiber->philo->waiter;
+	i = fiber->philo->id - 1;
+	pthread_mutex_lock(&waiter->lock);
+	if (waiter_seat(waiter, i))
+		run_push(sched, fiber);
+	else
+		waiter->parked[i] = fiber;
+	pthread_mutex_unlock(&waiter->lock);
+}
+
+/// @brief This function files the fiber that switched back to the
+// worker according to what it asked for. Called with the lock held.
+/// @param sched 
+/// @param fiber 
+static void	worker_park(t_sched *sched, t_fiber *fiber)
+{
+	if (fiber->action == FIBER_SLEEP)
+		timer_push(sched, fiber);
+	else if (fiber->action == FIBER_FORK && fiber->fork->taken)
+		fiber->fork->waiter = fiber;
+	else if (fiber->action == FIBER_FORK)
+	{
+		fiber->fork->taken = true;
+		run_push(sched, fiber);
+	}
+	else if (fiber->action == FIBER_LOG)
+	{
+		fiber->next = fiber->worker->logging;
+		fiber->worker->logging = fiber;
+	}
+	else if (fiber->action == FIBER_SEAT)
+		worker_seat(sched, fiber);
+	else if (fiber->action == FIBER_DONE)
+		sched->finished++;
+	else
+		run_push(sched, fiber);
+}
+
+/// @brief This function queues the fibers parked on the full ring of
+// the worker again once the logger has made room in it, or once
+// someone has died. Called with the lock held.
+/// @param worker 
+/// @return when to look again, in microseconds, or SIZE_MAX when no
+// fiber is left parked
+static size_t	worker_unlog(t_worker *worker)
+{
+	t_fiber	*fiber;
+
+	if (!worker->logging)
+		return (SIZE_MAX);
+	if (ring_full(worker->ring) && !check_dead_flag(worker->logging->philo))
+		return (clock_us() + LOG_PERIOD);
+	while (worker->logging)
+	{
+		fiber = worker->logging;
+		worker->logging = fiber->next;
+		run_push(worker->sched, fiber);
+	}
+	return (SIZE_MAX);
+}
+
+/// @brief This function hands a parked fiber back to the workers.
+/// @param fiber 
+void	worker_wake(t_fiber *fiber)
+{
+	t_sched	*sched;
+
+	sched = fiber->worker->sched;
+	pthread_mutex_lock(&sched->lock);
+	run_push(sched, fiber);
+	pthread_mutex_unlock(&sched->lock);
+}
+
+/// @brief This function runs ready fibers one after the other until
+// every fiber is done, and waits for the next timer when none is, or
+// for the logger when the fibers left wait for room in its ring.
+/// @param arg the worker
+/// @return 
+void	*worker_routine(void *arg)
+{
+	t_worker	*worker;
+	t_sched		*sched;
+	t_fiber		*fiber;
+	size_t		until;
+
+	worker = (t_worker *)arg;
+	sched = worker->sched;
+	pthread_mutex_lock(&sched->lock);
+	while (sched->finished < sched->fibers_amount)
+	{
+		until = worker_unlog(worker);
+		fiber = sched_next(sched);
+		if (!fiber)
+		{
+			sched_idle(sched, until);
+			continue ;
+		}
+		pthread_mutex_unlock(&sched->lock);
+		fiber_resume(worker, fiber);
+		pthread_mutex_lock(&sched->lock);
+		worker_park(sched, fiber);
+	}
+	pthread_cond_broadcast(&sched->wake);
+	pthread_mutex_unlock(&sched->lock);
+	return (arg);
+}